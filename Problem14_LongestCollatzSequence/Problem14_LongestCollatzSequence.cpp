@@ -41,164 +41,114 @@
 // there are memory leak concerns here).
 //
 
-#include <algorithm> // For *max_element() search function.
+// EDIT: Keeping every start value and count in vectors does
+// not scale (the memory concerns above are real for larger
+// caps), and only the best start value so far is ever
+// needed.  So each start value is now just counted by
+// countCollatzSteps() and compared on the fly.  The start
+// values are also cut into shards which are swept on all
+// cores by sweepRange() (see SharedLibrary/RangeSweep.h),
+// each shard keeping its own best (start, count) pair; the
+// pairs are combined in order, so ties still go to the
+// smallest start value.  It prints the progress as it goes
+// and, given a checkpoint file, saves the best pair so far
+// every minute, so very large caps can be stopped and
+// resumed.
+//
+// Usage: Problem14 [cap] [checkpoint file]
+//
+
 #include <cstdint> // For fast, large integer types
 #include <iostream>
-#include <vector> // for std::vector
 
-using largeint_t = std::int_fast64_t;
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/RangeSweep.h"
 
-class CollatzSequenceSet
+// Function to count the # of iterations in the Collatz
+// sequence that begins with startVal, until it reaches 1.
+// Throws if a value would overflow 64 bits.
+std::uint64_t countCollatzSteps(std::uint64_t startVal)
 {
-private:
-	std::vector<largeint_t> m_startVector{};
-	std::vector<largeint_t> m_countVector{};
-	largeint_t m_maxStartVal{};
-	largeint_t m_sequenceStartVal{};
-	largeint_t m_sequenceVal{};
-	largeint_t m_sequenceCount{};
-
-public:
-	CollatzSequenceSet() :
-		m_maxStartVal{ 1 }, m_sequenceStartVal{ 1 },
-		m_sequenceVal{ m_sequenceStartVal }, m_sequenceCount{ 0 }
-	{
-		// We implement the vector capacities this way
-		// so that the utilized memory is FIXED by maxStartVal
-		// and does not have the risk of unlimited dynamic
-		// memory allocation.
-		m_startVector.reserve(m_maxStartVal);
-		m_countVector.reserve(m_maxStartVal);
-	}
+	std::uint64_t sequenceVal{ startVal };
+	std::uint64_t sequenceCount{ 0 };
 
-	CollatzSequenceSet(largeint_t& maxStartVal) :
-		m_maxStartVal{ maxStartVal }, m_sequenceStartVal{ 1 },
-		m_sequenceVal{ m_sequenceStartVal }, m_sequenceCount{ 0 }
+	while (sequenceVal != 1)
 	{
-		m_startVector.reserve(maxStartVal);
-		m_countVector.reserve(maxStartVal);
+		// Now we check if the current value in sequence
+		// is even or odd:
+		if (sequenceVal % 2 == 0) // i.e. even:
+		{
+			sequenceVal /= 2;
+		}
+		else // i.e. odd:
+		{
+			if (sequenceVal > (UINT64_MAX - 1) / 3)
+				throw "in countCollatzSteps(): sequence value overflows 64 bits";
+			sequenceVal = (3 * sequenceVal) + 1;
+		}
+		// And note we did a step in the sequence:
+		++sequenceCount;
 	}
 
-	largeint_t& getmaxStartVal() { return m_maxStartVal; }
-	largeint_t& getsequencestartVal() { return m_sequenceStartVal; }
-	largeint_t& getsequenceVal() { return m_sequenceVal; }
-	largeint_t& getsequenceCount() { return m_sequenceCount; }
+	return sequenceCount;
+}
 
-	std::vector<largeint_t>& getstartVector() { return m_startVector; }
-	std::vector<largeint_t>& getcountVector() { return m_countVector; }
 
-	void setmaxStartVal(largeint_t& maxStartVal1)
+int main(int argc, char* argv[])
+{
+	// First, we take the cap for starting numbers (one
+	// million by default; at least 2, as there are no start
+	// values below 0 or 1 and cap - 1 would wrap around) and
+	// the checkpoint file (if any):
+	std::uint64_t maxStartCap{ 1000000 };
+	if (argc > 1 && !parseArgument(argv[1], 2, UINT64_MAX, maxStartCap))
 	{
-		m_maxStartVal = maxStartVal1;
-		// Because we've changed this here, we need to resize
-		// the vector objects as well:
-		m_startVector.reserve(maxStartVal1);
-		m_countVector.reserve(maxStartVal1);
+		std::cerr << "ERROR in main(): the cap must be a whole number, at least 2.\n";
+		return 1;
 	}
 
-	void incrementsequenceStartVal() { ++m_sequenceStartVal; }
-	void resetsequenceStartVal() { m_sequenceStartVal = 1; }
-	void incrementsequenceVal() { ++m_sequenceVal; }
-	void resetsequenceVal() { m_sequenceVal = m_sequenceStartVal; }
-	void incrementsequenceCount() { ++m_sequenceCount; }
-	void resetsequenceCount() { m_sequenceCount = 0; }
+	RangeSweepOptions options{};
+	options.checkpointFile = (argc > 2) ? argv[2] : "";
+	options.shardSize = 65536;
 
-	// Member function to count the # of iterations in
-	// a given Collatz sequence that begins with a
-	void countCurrentCollatzSequence()
+	try
 	{
-		// First, we need to record the starting value in
-		// the vector, using it like a stack:
-		m_startVector.push_back(getsequencestartVal());
-
-		// Now we need to run through the sequence and count
-		// the number of iterations in the while loop using
-		// m_sequenceCount.
-		while (getsequenceVal() != 1)
-		{
-			// Now we check if the current value in sequence
-			// is even or odd:
-			if (getsequenceVal() % 2 == 0) // i.e. even:
+		// Each shard's state is its (start value, count)
+		// with the longest chain; we need just below the cap:
+		const SweepState longest{ sweepRange(1, maxStartCap - 1, SweepState{ 0, 0 },
+			[](std::uint64_t first, std::uint64_t last, SweepState& shard)
 			{
-				m_sequenceVal = (m_sequenceVal / 2);
-			}
-			else // i.e. odd:
+				for (std::uint64_t startVal{ first }; startVal <= last; ++startVal)
+				{
+					const std::uint64_t count{ countCollatzSteps(startVal) };
+					if (shard[0] == 0 || count > shard[1])
+					{
+						shard[0] = startVal;
+						shard[1] = count;
+					}
+				}
+			},
+			[](SweepState& total, const SweepState& shard)
 			{
-				m_sequenceVal = ((3 * m_sequenceVal) + 1);
-			}
-			// And note we did a step in the sequence:
-			incrementsequenceCount();
-		}
-
-		// At the end here, we need to record the maximum
-		// count value, reset this count value for the next 
-		// loop, and move on to the next starting value, 
-		m_countVector.push_back(getsequenceCount());
-		resetsequenceCount();
-		incrementsequenceStartVal();
-		resetsequenceVal();
+				if (total[0] == 0 || shard[1] > total[1])
+					total = shard;
+			},
+			options) };
+
+		// Now we can print the starting value (and count
+		// value) for which we have maximized the count value
+		// (i.e. the longest chain) back to the user:
+		std::cout << "The starting value below " << maxStartCap
+			<< " which produces the longest chain in a Collatz "
+			<< "sequence was found to be " << longest[0]
+			<< ", with a chain " << longest[1]
+			<< " long.\n";
 	}
-
-	// Function to run all counting processes to fill out
-	// the member std::vector variables; runs from 1 up
-	// to m_maxStartVal.
-	void countAllStartValues()
+	catch (const char* exception)
 	{
-		while (getsequencestartVal() <= m_maxStartVal)
-		{
-			countCurrentCollatzSequence();
-		}
-
-		// Now that we have run all start values up to maxStartVal,
-		// we can reset m_sequenceStartVal:
-		resetsequenceStartVal();
-	}
-
-	// Member fucntions which finds and returns the starting
-	// value (in the range 1 to maxStartVal) which yields 
-	// the longest chain (by finding the position of the 
-	// largest value in countVector, and then using that
-	// position in the startVector to find the corresponding
-	// start value).
-	// Should only be called AFTER running countAllStartValues().
-	largeint_t findLongestChainStartVal()
-	{
-		return m_startVector.at((std::max_element(m_countVector.begin(), m_countVector.end()) - m_countVector.begin()));
+		std::cerr << "ERROR " << exception << ".\n";
+		return 1;
 	}
 
-	largeint_t findLongestChainCountVal()
-	{
-		return m_countVector.at((std::max_element(m_countVector.begin(), m_countVector.end()) - m_countVector.begin()));
-	}
-};
-
-
-int main()
-{
-	// First, we ask user to enter the cap for starting numbers
-	// (e.g. 1e6, or one million is what is entered here):
-	std::cout << "Enter the maximum number below which to "
-		<< "check starting values in Collatz sequences: ";
-	largeint_t maxStartCap{};
-	std::cin >> maxStartCap;
-	// We need just below this cap for m_maxStartVal:
-	--maxStartCap;
-
-	// Now we initialize the class object:
-	CollatzSequenceSet csSet{ maxStartCap };
-
-	// Now we need to run the member function countAllStartValues
-	// to fill out the vectors therein:
-	csSet.countAllStartValues();
-
-	// Now we can ask for the starting value (and/or count value)
-	// for which we have maximized the count value (i.e. the
-	// longest chain), and print this back to the user:
-	std::cout << "The starting value below " << (maxStartCap + 1)
-		<< " which produces the longest chain in a Collatz "
-		<< "sequence was found to be " << csSet.findLongestChainStartVal()
-		<< ", with a chain " << csSet.findLongestChainCountVal()
-		<< " long.\n";
-
 	return 0;
-}
\ No newline at end of file
+}
@@ -48,6 +48,19 @@ We can then continue this going up each level in the triangle
 until we reach the top row, which will yield our final sum in
 the end.
 
+EDIT: Collapsing row r is now a single call to maxPlusRow()
+from the SharedLibrary (also used by problem 67), which
+computes a + max(b,c) for a whole row at once, 8 entries per
+AVX2 instruction when built with AVX2.  The triangle is held
+as int32_t rows for this.
+
+Once collapsed, each entry holds the best sum of a path
+from it down to the bottom, so the path itself is found by
+walking back down from the top, always stepping to the
+child with the larger collapsed value.  The value of each
+entry on the way is its collapsed value less that of the
+child taken.
+
 */
 
 
@@ -55,8 +68,10 @@ the end.
 #include <iostream>
 #include <vector>
 
+#include "../SharedLibrary/MaxPathSum.h"
+
 
-using lint_t = int_fast16_t;
+using lint_t = int32_t;
 
 
 int main()
@@ -90,23 +105,16 @@ int main()
     };
 
 
-    /* Use the sub-triangle algorithm to modify numberTriang 
-    and calculate the maximum sum.
-    Utilizes the std::max() function.for comparison of elements: */
+    /* Use the sub-triangle algorithm to modify numberTriang
+    and calculate the maximum sum.  Each call replaces the
+    value a with a + max(b,c) for every sub-triangle along a
+    row, i.e. for all a in a given row s.t. we ensure we check
+    all existing paths, effectively, without calculating the
+    actual total sum of each path. */
     for (int currentRow{ static_cast<int>(numberTriang.size()) - 2 }; currentRow >= 0; --currentRow)
     {
-        for (int currentPos{ 0 }; currentPos <= currentRow; currentPos++)
-        {
-            /* This is checking the condition of the sub-triangle,
-            i.e. replacing the value a with a + max(b,c) for each
-            sub-triangle in the overall problem.  Note this is done
-            for all a in a given row s.t. we ensure we check all
-            existing paths, effectively, without calculating the
-            actual total sum of each path. */
-            numberTriang.at(currentRow).at(currentPos)
-                += std::max(numberTriang.at(currentRow + 1).at(currentPos),
-                    numberTriang.at(currentRow + 1).at(currentPos + 1));
-        }
+        maxPlusRow(numberTriang[currentRow].data(), numberTriang[currentRow + 1].data(),
+            numberTriang[currentRow].data(), static_cast<std::size_t>(currentRow) + 1);
     }
 
 
@@ -116,5 +124,19 @@ int main()
         << numberTriang.at(0).at(0) << ".\n";
 
 
+    /* Recover and report the path itself: */
+    std::cout << "The path taken is: ";
+    std::size_t currentPos{ 0 };
+    for (std::size_t currentRow{ 0 }; currentRow + 1 < numberTriang.size(); ++currentRow)
+    {
+        const std::size_t nextPos{ (numberTriang[currentRow + 1][currentPos]
+            >= numberTriang[currentRow + 1][currentPos + 1]) ? currentPos : currentPos + 1 };
+        std::cout << numberTriang[currentRow][currentPos] - numberTriang[currentRow + 1][nextPos]
+            << " -> ";
+        currentPos = nextPos;
+    }
+    std::cout << numberTriang.back()[currentPos] << ".\n";
+
+
     return 0;
 }
\ No newline at end of file
@@ -4,28 +4,22 @@
 #include "Problem24_FunctionLibrary.h"
 
 /* Function to extract all digit values from the input string
-   and return these as an std::vector<int>. */
+   and return these as an std::vector<int>, sorted by value.
+   Non-digit characters are ignored, i.e. only 0-9 values are
+   accepted.  The digits are counted into a digit signature
+   (see the shared Digits.h) and then written out digit by
+   digit in increasing order, which ensures the first correct
+   permutation (e.g. 0123, or 0123456789) without a sort. */
 std::vector<int> extractDigitstoVector(std::string str)
 {
-	std::vector<int> temp;
+	const uint64_t signature{ digitSignature(str) };
 
-	for (auto i : str)
+	std::vector<int> temp;
+	for (int digit{ 0 }; digit <= 9; ++digit)
 	{
-		/* This ignores non - digit values, i.e.only
-		accepts 0-9 values.*/
-		if (isdigit(i))
-		{
-			temp.push_back(i - '0');
-		}
+		temp.insert(temp.end(), signatureDigitCount(signature, digit), digit);
 	}
 
-	/*
-	Now we want this to initially sort the digits by value.
-	We use a basic sort() algorithm for this.  This ensures
-	the first correct permutation (e.g. 0123, or 0123456789).
-	*/
-	std::sort(temp.begin(), temp.end());
-
 	return temp;
 }
 
@@ -1,14 +1,14 @@
 #ifndef PROBLEM24_FUNCTIONLIBRARY_H
 #define PROBLEM24_FUNCTIONLIBRARY_H
 
-#include <algorithm> // For sort().
-#include <cctype> // For isdigit().
 #include <cstdint> // For large integer (non-digit) types.
 #include <iostream>
 #include <string> // For std::string.
 #include <sstream> // For stringstream.
 #include <vector>
 
+#include "../SharedLibrary/Digits.h"
+
 std::vector<int> extractDigitstoVector(std::string str);
 
 std::ostringstream printcurrentDigits(std::vector<int> cpvec);
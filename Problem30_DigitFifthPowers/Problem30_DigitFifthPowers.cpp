@@ -23,135 +23,199 @@ as inputs (i.e. check(val, extractDigits(val)) ).
 Note also that as in the problem description for 4th
 powers, we must ignore values with only 1 digit (e.g.,
 1^4) since they cannot be a sum.
+
+EDIT: The digits are now extracted with extractDigits()
+from the shared Digits.h (see the SharedLibrary), which
+peels off two digits per division by 100 into a stack
+array, instead of formatting each value through a
+stringstream into a new vector.
+
+EDIT: Scanning every value up to the bound still means
+10^d checks for d digits, most of them redundant: the sum
+of digit powers only depends on which digits a value has,
+not their order.  So instead of the values, we go through
+the multisets of d digits (the counts of each digit 0-9,
+C(d + 9, 9) of them, e.g. 5005 for d = 6 rather than a
+million), add up their powers from a table built at
+compile time, and check whether the sum's own digits are
+that same multiset (comparing the packed digit signatures
+of Digits.h).  A sum that matches is a solution, and each
+is found exactly once.  While choosing the count of each
+digit, a partial sum that is already too large, or can no
+longer reach d digits, cuts the rest of that branch off.
+
+This makes any exponent up to 20 feasible (9^20 still fits
+in 64 bits, but the sums can pass 2^64, so they are kept
+in 128 bits, see UInt128.h).  The bound on d is the
+largest d with d * 9^p >= 10^(d-1), as above.
+
+Usage: Problem30 [exponent]
 */
 
+#include <algorithm> // For std::sort().
+#include <cstddef> // For std::size_t, std::ptrdiff_t.
+#include <cstdint>
 #include <iostream>
-#include <sstream> // for stringstream class.
 #include <vector>
 
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/Digits.h"
+#include "../SharedLibrary/UInt128.h"
+
 
-using largeint_t = int_fast64_t;
+/* Largest exponent handled (9^20 < 2^64 < 9^21): */
+constexpr int maxExponent{ 20 };
 
 
-/* Function to extract digits of an int value
-   into a vector: */
-std::vector<int> extractDigitstoVec(const largeint_t& val)
+/* Table of digit^exp for every digit 0-9 and exponent up to
+maxExponent, built at compile time: */
+struct DigitPowerTables
 {
+	uint64_t power[maxExponent + 1][10]{};
+
+	constexpr DigitPowerTables()
+	{
+		for (int digit{ 0 }; digit < 10; ++digit)
+		{
+			power[0][digit] = 1;
+			for (int exp{ 1 }; exp <= maxExponent; ++exp)
+				power[exp][digit] = power[exp - 1][digit] * static_cast<uint64_t>(digit);
+		}
+	}
+};
 
-	std::stringstream valSS{};
-	valSS << val;
-	std::string valStr{};
-	valSS >> valStr;
+constexpr DigitPowerTables digitPowerTables{};
 
-	std::vector<int> valVec{};
 
-	for (int it{ 0 }; it < static_cast<int>(valStr.length()); ++it)
+/* Function to find the digit signature (see Digits.h) of
+a 128-bit value, nine digits at a time from the bottom
+(the leading zeros of each lower chunk are real zeros): */
+uint64_t calculateSignature128(UInt128 value)
+{
+	uint64_t signature{ 0 };
+	while (value.high() != 0 || value.low() >= 1000000000)
 	{
-		/* Requires an implict type-cast from char to int,
-		hence the - '0'. */
-		valVec.push_back(valStr[it] - '0');
+		const uint32_t chunk{ value.divideBy(1000000000) };
+		signature += digitSignature(chunk) + static_cast<uint64_t>(9 - countDigits(chunk));
 	}
-
-	return valVec;
+	return signature + digitSignature(value.low());
 }
 
-/* Function to execute power relationships: */
-largeint_t calculateDigitPower(const int& digit, const int& exp)
+
+/* What one search over d-digit multisets needs: the
+exponent, the range [10^(d-1), 10^d) that the sum has to
+land in, and the values found: */
+struct DigitPowerSearch
+{
+	int exp{};
+	UInt128 lowest{};
+	UInt128 highest{};
+	std::vector<UInt128> found{};
+};
+
+
+/* Function to choose how many of each digit (from digit
+down to 0) make up the remaining digits of the multiset,
+with sum the powers of the digits chosen so far and
+signature their digit signature: */
+void chooseDigitCounts(DigitPowerSearch& search, int digit, int remaining, UInt128 sum, uint64_t signature)
 {
-	largeint_t result{ 1 };
+	/* The rest are zeros, which add nothing to the sum: */
+	if (digit == 0)
+	{
+		signature += static_cast<uint64_t>(remaining);
+		if (sum >= search.lowest && sum < search.highest && calculateSignature128(sum) == signature)
+			search.found.push_back(sum);
+		return;
+	}
 
-	for (int i{ 1 }; i <= exp; ++i)
+	const uint64_t power{ digitPowerTables.power[search.exp][digit] };
+	for (int count{ 0 }; count <= remaining; ++count)
 	{
-		result *= static_cast<largeint_t>(digit);
+		/* Too large already (and more of this digit only
+		adds more): */
+		if (sum >= search.highest)
+			break;
+
+		/* Too small even with all the rest as this digit: */
+		if (sum + UInt128::multiply(power, static_cast<uint64_t>(remaining - count)) >= search.lowest)
+			chooseDigitCounts(search, digit - 1, remaining - count, sum, signature);
+
+		sum += UInt128{ power };
+		signature += uint64_t{ 1 } << (6 * digit);
 	}
-	
-	return result;
 }
 
-/* Function to check if the sum of a value's 
-   digits' fifth powers is equal to the value.
-   Returns true if the value satisfies this
-   equality, false otherwise.  Note when called
-   in main() this should have implicit call to 
-   extractDigits() in its second parameter.*/
-bool checkDigitFifthPowers(const largeint_t& value)
-{
-	largeint_t sumDigitFifthPower{ 0 };
-	std::vector<int> valueDigits{ extractDigitstoVec(value) };
 
-	for (int digit : valueDigits)
+/* Function to find all values of two or more digits that
+are the sum of the exp-th powers of their digits, in
+increasing order: */
+std::vector<UInt128> findDigitPowerSums(int exp)
+{
+	DigitPowerSearch search{};
+	search.exp = exp;
+	search.lowest = UInt128{ 10 };
+	search.highest = UInt128{ 100 };
+
+	const uint64_t maxPower{ digitPowerTables.power[exp][9] };
+	for (int numDigits{ 2 }; UInt128::multiply(static_cast<uint64_t>(numDigits), maxPower) >= search.lowest;
+		++numDigits)
 	{
-		sumDigitFifthPower += calculateDigitPower(digit, 5);
+		const std::size_t numFoundBefore{ search.found.size() };
+		chooseDigitCounts(search, 9, numDigits, UInt128{ 0 }, 0);
+
+		/* Within one d, the multisets come in no useful
+		order: */
+		std::sort(search.found.begin() + static_cast<std::ptrdiff_t>(numFoundBefore), search.found.end());
+
+		search.lowest = search.highest;
+		search.highest *= UInt128{ 10 };
 	}
 
-	if (sumDigitFifthPower == value)
-		return true;
-	else
-		return false;
+	return search.found;
 }
 
 
-int main()
+int main(int argc, char* argv[])
 {
-	/*
-	Initialize a total sum variable:
-	*/
-	largeint_t sumTotal{};
-
-	/* DEBUG: Vector to record value of the total sum: */
-	std::vector<largeint_t> sumComponents{};
-	
-	/*
-	For loop for finding numbers who are the sum of
-	their digits' fifth powers. Note we must start 
-	with two digit values (i.e. at 10), since 1-digit
-	values aren't sums.
-
-	Also note the upper bound of this loop is not obvious.
-	However, since these are single digits, we can note a
-	reasonable range is:
-		10^(d-1) <= d * 9^5 < 10^(d)
-	where d represents the number of digits.  Applying
-	logarithms (base 10) to this inequality yeilds:
-		(d-1)log(10) <= log(d) + 5log(9) < d log(10)
-		(d-1) <= log(d) + 5log(9) < d
-		d-log(d) <= 5log(9) + 1 < d - log(d) + 1
-	Note 5log(9) + 1 = 5.77, approximately:
-		d - log(d) <= 5.77 < d - log(d) + 1
-	Since we expect d - log(d) to be somewhat close to d,
-	we can plug d=5 into the logarithms:
-		d <= 6.47 < d + 1
-	Thus, we might expect the max upper bound to be 7 digits
-	at the most (i.e. 10000000 = 10^7, which covers up to
-	999999).  Also note that 7 * 9^5 = 413343, which covers
-	almost half that range (note this is the maximum SUM
-	value for digits' fifth powers, and thus also caps the
-	value itself).
-	*/
-	for (largeint_t value1{10}; value1 <= 413343; ++value1)
+	/* The exponent, 5 by default: */
+	uint64_t exp{ 5 };
+	if (argc > 1 && !parseArgument(argv[1], 1, maxExponent, exp))
 	{
-		if (checkDigitFifthPowers(value1))
-		{
-			sumTotal += value1;
-			sumComponents.push_back(value1);
-		}
+		std::cerr << "ERROR in main(): the exponent must be from 1 to " << maxExponent << ".\n";
+		return 1;
+	}
+
+	/* Find the values and their total sum: */
+	const std::vector<UInt128> sumComponents{ findDigitPowerSums(static_cast<int>(exp)) };
+
+	UInt128 sumTotal{ 0 };
+	for (const UInt128& value : sumComponents)
+		sumTotal += value;
+
+	/* Some exponents (e.g. 1 and 2) have no such numbers: */
+	if (sumComponents.empty())
+	{
+		std::cout << "No numbers can be written as the sum of the "
+			<< exp << "-th powers of their digits.\n";
+		return 0;
 	}
 
 	/* Report the value of the sum to the user: */
 	std::cout << "The sum of all numbers that can be written as "
-		<< "the sum of the fifth powers of their digits yields "
-		<< sumTotal << ".\n";
+		<< "the sum of the " << exp << "-th powers of their digits yields "
+		<< sumTotal.toString() << ".\n";
 
 	/* DEBUG: Also report the components of the sum.*/
 	std::cout << "The components of this sum are: ";
-	for (int i{ 0 }; i < sumComponents.size(); ++i)
+	for (std::size_t i{ 0 }; i < sumComponents.size(); ++i)
 	{
 		if (i != (sumComponents.size() - 1))
-			std::cout << sumComponents.at(i) << " + ";
+			std::cout << sumComponents.at(i).toString() << " + ";
 		else
-			std::cout << sumComponents.at(i);
+			std::cout << sumComponents.at(i).toString();
 	}
-	std::cout << " = " << sumTotal << ".\n";
+	std::cout << " = " << sumTotal.toString() << ".\n";
 
 	return 0;
-}
\ No newline at end of file
+}
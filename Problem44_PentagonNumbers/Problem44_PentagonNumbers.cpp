@@ -58,220 +58,207 @@ we need to calculate it as a double value.
 We can implement this in the existing function in place
 of the database method.
 
+EDIT: That inverse calculation is only as good as the
+double it is done in: once 24x + 1 passes 2^53 it is
+rounded before the square root is even taken, so a
+non-pentagonal x can give a whole n (and a pentagonal one
+can miss).  The checks below now use isPolygonal() from
+SharedLibrary/Polygonal.h instead, which decides whether
+24x + 1 is a perfect square of the form 6n - 1 in exact
+integer arithmetic (128 bits where needed), and also gives
+the index n, so the pair's indices are exact as well.
+The pentagonal numbers themselves come from
+polygonalNumber(), so the database of them (and its sum
+and difference checks) is gone.
+
+EDIT: The search over a window of j and k (entered by
+hand) could never show that the smallest D it found was
+the smallest there is, since a pair further out might
+have a smaller difference.  The search now goes by D
+instead, in increasing order.  D has to be pentagonal
+itself, so only D = P_d for d = 1, 2, 3, ... is tried,
+and for each one every pair with that difference is
+found directly: with a = k - j and b = k + j,
+	P_k - P_j = a (3b - 1) / 2,
+so the pairs are the ways of writing 2D = d (3d - 1) as
+a times (3b - 1), with b > a and of the same parity.  As
+d and 3d - 1 share no factor, the divisors a come from
+factoring each of them by trial division, and only a few
+dozen candidate pairs are left to test for a pentagonal
+sum.  The first d with such a pair therefore gives the
+minimal D, proven, and the search stops there.
+
+The d values are cut into shards which are searched on
+all cores by sweepRange() (see SharedLibrary/RangeSweep.h),
+combined in order, so the first hit in the first shard
+with one is the answer, and the search ends there.  P_k
+can be around 3 d^4 / 8, so the sum is tested in 128 bits.
+
+Usage: Problem44 [maximum d] [checkpoint file]
+
 */
 
-#include <algorithm> // for min_element().
 #include <cstdint> // For large int types.
 #include <iostream>
-#include <math.h> // for sqrt()
 #include <vector>
 
-using largeint_t = int_fast64_t;
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/Polygonal.h"
+#include "../SharedLibrary/RangeSweep.h"
+#include "../SharedLibrary/UInt128.h"
+
 
-/* Function to generate a pentagonal number: */
-largeint_t calculatePentagNumN(const largeint_t& n)
+/* Function to check if a sum of two pentagonal
+   numbers (P_j and P_k by index, in 128 bits)
+   is a pentagonal number using the exact
+   inverse test: */
+bool checkPentSumByInv(uint64_t j, uint64_t k)
 {
-	return ((n * ((3 * n) - 1) )/ 2); // Note the integer division concern here.
+	uint64_t index{};
+	return isPolygonal(5, polygonalNumber(5, j) + polygonalNumber(5, k), index);
 }
 
 
-/* Boolean function to check whether the sum
-   of two pentagonal numbers exists in the
-   pentagonal database vector: */
-/*bool checkPentagonSum(const std::vector<largeint_t>& pentVec, const largeint_t& pj, const largeint_t& pk)
+/* Function to list the divisors of n (in no
+   particular order) from its prime factors,
+   found by trial division: */
+std::vector<uint64_t> calculateDivisors(uint64_t n)
 {
-	for (largeint_t pent : pentVec)
-	{ */
-		// If sum exists in pentVec, return true.
-		/*if ((pj + pk) == pent)
-		{
-			return true;
-		}
-	}*/
-	// Otherwise, return false:
-	/*return false;
-}*/
+	std::vector<uint64_t> divisors{ 1 };
 
+	for (uint64_t p{ 2 }; p * p <= n; ++p)
+	{
+		if (n % p != 0)
+			continue;
 
-/* Boolean function to check whether the difference
-   of two pentagonal numbers exists in the
-   pentagonal database vector: */
-/*bool checkPentagonDiff(const std::vector<largeint_t>& pentVec, const largeint_t& pj, const largeint_t& pk)
-{
-	for (largeint_t pent : pentVec)
-	{ */
-		/* If diff exists in pentVec, return true. */
-		/*if ((pk - pj) == pent)
+		/* Each divisor so far times p, p^2, ...: */
+		const std::size_t numBefore{ divisors.size() };
+		uint64_t power{ 1 };
+		while (n % p == 0)
 		{
-			return true;
+			n /= p;
+			power *= p;
+			for (std::size_t i{ 0 }; i < numBefore; ++i)
+				divisors.push_back(divisors[i] * power);
 		}
-	}*/
-	// Otherwise, return false:
-	/*return false;
-}*/
+	}
 
-/* Function to check if a sum of two pentagonal
-   numbers is a pentagonal number using the
-   inverse function method: */
-bool checkPentSumByInv(const largeint_t& pj, const largeint_t& pk)
-{
-	largeint_t sumVal{ (pj+pk) };
-	double nVal{};
-
-	nVal = ( (sqrt(24 * sumVal + 1) + 1) / 6);
-
-	/* Checks that nVal is the same as a double 
-	and as a integer, and that its value is not 
-	infinite:  */
-	if ((nVal == floor(nVal)) && (!isinf(nVal)))
-		return true;
-	else
-		return false;
-}
+	/* What is left over is a prime: */
+	if (n > 1)
+	{
+		const std::size_t numBefore{ divisors.size() };
+		for (std::size_t i{ 0 }; i < numBefore; ++i)
+			divisors.push_back(divisors[i] * n);
+	}
 
-/* Function to check if a diff of two pentagonal
-   numbers is a pentagonal number using the
-   inverse function method: */
-bool checkPentDiffByInv(const largeint_t& pj, const largeint_t& pk)
-{
-	largeint_t diffVal{ (pk - pj) };
-	double nVal{};
-
-	nVal = ((sqrt(24 * diffVal + 1) + 1) / 6);
-
-	/* Checks that nVal is the same as a double
-	and as a integer, and that its value is not
-	infinite:  */
-	if ( (nVal == floor(nVal)) && (!isinf(nVal)) )
-		return true;
-	else
-		return false;
+	return divisors;
 }
 
 
-
-int main()
+/* Function to find a pair P_j < P_k with difference
+   D = P_d whose sum is also pentagonal; returns
+   false if there is none.  2D = d (3d - 1) has to
+   split as a (3b - 1) with a = k - j, b = k + j,
+   and d, 3d - 1 have no common factor, so each
+   divisor a of 2D is a divisor of d times one of
+   3d - 1 (with the 2 put on either side): */
+bool findPentPairForDiff(uint64_t d, uint64_t& j, uint64_t& k)
 {
-	/*
-	Ask for the bounds of n to check for
-	minimum pentagonal D:  Note that this
-	allows the user to narrow into ranges,
-	such that if one doesn't find a valid
-	answer for 1 <= n <= maxN, e.g., they
-	can now look for maxN <= n <= newMaxN.
-	*/
-	std::cout << "Enter the minimum value of n for generating pentagonal numbers (start with 1 if unsure): ";
-	largeint_t minN{};
-	std::cin >> minN;
-
-	std::cout << "Enter the maximum value of n for generating pentagonal numbers: ";
-	largeint_t maxN{};
-	std::cin >> maxN;
-
-	/*
-	Generate a database of pentagonal values in
-	the range of n provided:
-	*/
-	/*std::vector<largeint_t> pentagonValues{};
-
-	for (largeint_t i{ minN }; i <= maxN; ++i)
-	{
-		pentagonValues.push_back(calculatePentagNumN(i));
-	}*/
-	/* DEBUG: Print this vector:
-	for (largeint_t a : pentagonValues)
+	const uint64_t twiceD{ d * (3 * d - 1) };
+	const std::vector<uint64_t> divisorsOfd{ calculateDivisors(d) };
+	const std::vector<uint64_t> divisorsOf3dMinus1{ calculateDivisors(3 * d - 1) };
+
+	for (uint64_t a1 : divisorsOfd)
 	{
-		std::cout << a << ", ";
+		for (uint64_t a2 : divisorsOf3dMinus1)
+		{
+			const uint64_t a{ a1 * a2 };
+			const uint64_t q{ twiceD / a }; // = 3b - 1
+
+			/* b must be whole, larger than a (so j >= 1)
+			and of the same parity as a (so j, k are whole): */
+			if (q % 3 != 2)
+				continue;
+			const uint64_t b{ (q + 1) / 3 };
+			if (b <= a || (b - a) % 2 != 0)
+				continue;
+
+			if (checkPentSumByInv((b - a) / 2, (b + a) / 2))
+			{
+				j = (b - a) / 2;
+				k = (b + a) / 2;
+				return true;
+			}
+		}
 	}
-	std::cout << '\n';*/
 
+	return false;
+}
 
-	/*
-	Now we need to sweep sums and differences in this
-	vector database and check for pentagonal values, and
-	record the difference values for such pairs:
-	*/
-	std::vector<largeint_t> pentDiffValues{};
-	std::vector<std::vector<largeint_t>> pentDiffPairs{};
-	std::vector<largeint_t> tempPair{};
-	tempPair.resize(2);
-
-	std::vector<largeint_t> tempNPair{};
-	std::vector<std::vector<largeint_t>> pentDiffNPairs{};
-	tempNPair.resize(2);
 
-	largeint_t pj{};
-	largeint_t pk{};
 
-	for (largeint_t itj{minN}; itj <= maxN; ++itj)
+int main(int argc, char* argv[])
+{
+	/* The largest d to try for D = P_d (a million by
+	default, well past the answer; at most 2^30, which
+	keeps P_j + P_k within 128 bits, as P_k is at most
+	about 3 d^4 / 8) and the checkpoint file, if any: */
+	uint64_t maxd{ 1000000 };
+	if (argc > 1 && !parseArgument(argv[1], 1, uint64_t{ 1 } << 30, maxd))
 	{
-		pj = calculatePentagNumN(itj);
+		std::cerr << "ERROR in main(): the maximum d must be from 1 to 2^30.\n";
+		return 1;
+	}
 
-		for (largeint_t itk{ minN }; itk <= maxN; ++itk)
-		{
-			pk = calculatePentagNumN(itk);
+	RangeSweepOptions options{};
+	options.checkpointFile = (argc > 2) ? argv[2] : "";
+	options.shardSize = 256;
 
-			// Skips repeat values, ensures D is positive.
-			if (pk > pj)
+	/* Each shard's state is its first d with a valid
+	pair, and that pair (d = 0 for none): */
+	SweepState found{};
+	try
+	{
+		found = sweepRange(1, maxd, SweepState{ 0, 0, 0 },
+			[](uint64_t first, uint64_t last, SweepState& shard)
 			{
-				/* If both the sum and diff of Pj, Pk in
-				range are pentagonal: */
-				/*if (checkPentagonSum(pentagonValues, pj, pk) && checkPentagonDiff(pentagonValues, pj, pk))*/
-				/* checkPentSumByInv(pj, pk) || */
-				if (checkPentSumByInv(pj, pk) && checkPentDiffByInv(pj, pk))
+				for (uint64_t d{ first }; d <= last; ++d)
 				{
-					// Record the difference value:
-					pentDiffValues.push_back((pk - pj));
-
-					// And record the relevant pair for that D:
-					tempPair.at(0) = pj;
-					tempPair.at(1) = pk;
-					tempNPair.at(0) = static_cast<largeint_t>(floor(((sqrt(24 * pj + 1) + 1) / 6)));
-					tempNPair.at(1) = static_cast<largeint_t>(floor(((sqrt(24 * pk + 1) + 1) / 6)));
-
-					pentDiffPairs.push_back(tempPair);
-					pentDiffNPairs.push_back(tempNPair);
+					uint64_t j{}, k{};
+					if (findPentPairForDiff(d, j, k))
+					{
+						shard = SweepState{ d, j, k };
+						break;
+					}
 				}
-			}
-		}
+			},
+			[](SweepState& total, const SweepState& shard)
+			{
+				if (total[0] == 0)
+					total = shard;
+			},
+			options,
+			[](const SweepState& total) { return total[0] != 0; });
+	}
+	catch (const char* exception)
+	{
+		std::cerr << "ERROR " << exception << ".\n";
+		return 1;
 	}
-
-	/*
-	Now we have a vector of all difference values
-	satisfying conditions 1)-3).  For the final
-	condition 4), we use min_element() to search
-	this vector for the smallest value of D,
-	and then report that D value and its associated
-	pair:
-	*/
-
-	/* DEBUG: used to check that the readout below works:
-	pentDiffValues.push_back(1);
-	pentDiffValues.push_back(2);
-	pentDiffPairs.push_back({ 1, 2 });
-	pentDiffPairs.push_back({ 3, 4 }); 
-	pentDiffNPairs.push_back({ 1, 2 });
-	pentDiffNpairs.push_back({ 3, 4 });
-	*/
 
 	// If we find no valid D values, report this:
-	if (pentDiffValues.empty())
+	if (found[0] == 0)
 	{
-		std::cout << "No valid pentagonal differences were found in the range "
-			<< minN << " <= n <= " << maxN << ".\n";
+		std::cout << "No pentagonal pair has a pentagonal sum and a difference D = P_d with d <= "
+			<< maxd << ".\n";
 	}
-	else // We have valid D values:
+	else // The smallest D there is:
 	{
-		largeint_t minDposition{ std::distance(pentDiffValues.begin(), std::min_element(pentDiffValues.begin(), pentDiffValues.end())) };
-
-		std::cout << "The minimum pentagonal difference was found to be "
-			<< pentDiffValues.at(minDposition) << " for the pair (P_" 
-			<< pentDiffNPairs.at(minDposition).at(0) << ", P_"
-			<< pentDiffNPairs.at(minDposition).at(1) << ") = ("
-			<< pentDiffPairs.at(minDposition).at(0) << ", "
-			<< pentDiffPairs.at(minDposition).at(1)
-			<< ") for the range of " << minN << " <= n <= " << maxN << ".\n";
+		std::cout << "The minimum pentagonal difference was found to be D = P_" << found[0]
+			<< " = " << polygonalNumber(5, found[0]).toString() << " for the pair (P_"
+			<< found[1] << ", P_" << found[2] << ") = (" << polygonalNumber(5, found[1]).toString()
+			<< ", " << polygonalNumber(5, found[2]).toString() << "), with no smaller D possible.\n";
 	}
 
 	return 0;
-}
\ No newline at end of file
+}
@@ -34,163 +34,88 @@ the input value (this minimizes use of memory).
 NOTE: At current this code works fine, but it
 may be too convoluted and could possibly be
 simplified in the future.
+
+EDIT: It was also quadratic (every triangular
+candidate rescanned p and h from 165 and 143) and
+capped at 10^5.  Now, note first that every hexagonal
+number is triangular, H_h = T_(2h - 1), so only
+pentagonal and hexagonal need to match.  Completing
+the square in P_p = H_h gives
+    (6p - 1)^2 - 3 (4h - 1)^2 = -2,
+a generalized Pell equation, and all its solutions come
+from a few starting ones by a fixed linear map (from
+the solution 7^2 - 12 * 2^2 = 1 of the ordinary Pell
+equation).  So the common values come out one after the
+other, with nothing to search.  This is done for any two
+polygonal kinds by PolygonalIntersection (see
+SharedLibrary/FigurateIntersection.h), with BigUInt
+values since the k-th one has about 4.6 k digits (225
+for the 50th), which all come out instantly.  At most
+1000 are listed (about half a second, mostly printing).
+
+Usage: Problem45 [how many to list]
 */
 
 #include <cstdint>
 #include <iostream>
 
-using largeint_t = int_fast64_t;
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/BigUInt.h"
+#include "../SharedLibrary/FigurateIntersection.h"
 
 
-/* Function to calculate triangular numbers: */
-largeint_t calculateTriNum(largeint_t& n)
+/* Function to calculate the triangular index of a
+hexagonal number, as H_h = T_(2h - 1): */
+BigUInt calculateTriIndex(const BigUInt& hexN)
 {
-    return ( (n * ( n + 1 ) ) / 2 );
+    BigUInt triN{ hexN * 2 };
+    triN -= BigUInt{ 1 };
+    return triN;
 }
 
-/* Function to check for pentagonal status
-   and return the n value for P_n if yes;
-   returns 0 if not found. */
-largeint_t checkPentNum(largeint_t& triVal)
-{
-    largeint_t pentVal{};
-
-    for (largeint_t p{ 165 }; p <= 100000; ++p)
-    {
-        pentVal = ((p * (3 * p - 1)) / 2);
-
-        /* Ignore further p values if pentVal
-        exceeds triVal and return as 0: */
-        if (pentVal > triVal)
-        {
-            return 0;
-        }
-
-        /* Return p if we find a match to triVal: */
-        if (pentVal == triVal)
-        {
-            return p;
-        }
-    }
 
-    /* Throws an exception in main() that upper
-    bound of p is too small (only way to reach
-    this point).*/
-    return -1;
-}
-
-
-/* Function to check for Hexagonal status
-   and return the n value for H_n if yes;
-   returns 0 if not found. */
-largeint_t checkHexNum(largeint_t& triVal)
+int main(int argc, char* argv[])
 {
-    largeint_t hexVal{};
-
-    for (largeint_t h{ 143 }; h <= 100000; ++h)
+    /* The number of tri/pent/hex numbers to list (by
+    default none, only the next one above 40755): */
+    uint64_t listCount{ 0 };
+    if (argc > 1 && !parseArgument(argv[1], 0, 1000, listCount))
     {
-        hexVal = (h * (2 * h - 1) );
-
-        /* Ignore further h values if pentVal
-        exceeds triVal and return as 0: */
-        if (hexVal > triVal)
-        {
-            return 0;
-        }
-
-        /* Return h if we find a match to triVal: */
-        if (hexVal == triVal)
-        {
-            return h;
-        }
+        std::cerr << "ERROR in main(): the number to list must be from 0 to 1000.\n";
+        return 1;
     }
 
-    /* Throws an exception in main() that upper
-    bound of h is too small.*/
-    return -1;
-}
-
-
-int main()
-{
-    /*
-    Initialize a variable for triangular values,
-    set by a for loop for n values starting at 285:
-    */
-    largeint_t triValue{};
-    largeint_t triN{ 0 };
-    largeint_t pentN{};
-    largeint_t hexN{};
-
-    /* DEBUG NOTE: for the purposes of testing the
-    functions and this code, one can start n at
-    285, which automatically outputs the 40755
-    values. */
-
-    for (largeint_t n{ 286 }; n <= 100000; ++n)
+    try
     {
-        /* Get triangular number and check it
-        for pentagonal and hexagonal status
-        via functions: */
-        triValue = calculateTriNum(n);
+        /* Pentagonal (5) and hexagonal (6) numbers at once;
+        1 = T_1 = P_1 = H_1 and 40755 come first: */
+        PolygonalIntersection pentHex{ 5, 6 };
 
-        pentN = checkPentNum(triValue);
-        hexN = checkHexNum(triValue);
-
-        /* Exceptions thrown when p, h ranges
-        are too small in the check functions: */
-        try
+        for (uint64_t k{ 1 }; k <= listCount; ++k)
         {
-            if (pentN == -1)
-                throw "in checkPentNum(): p upper bound too small; no valid return";
-
-            if (hexN == -1)
-                throw "in checkHexNum(): h upper bound too small; no valid return";
+            const FigurateMatch match{ pentHex.next() };
+            std::cout << k << ": T_" << calculateTriIndex(match.tIndex) << " = P_" << match.sIndex
+                << " = H_" << match.tIndex << " = " << match.value << '\n';
         }
-        catch (const char* exception)
-        {
-            std::cerr << "ERROR " << exception << ".\n";
-        }
-
 
-        /* Checks for pentagonal/hexagonal status.
-        Note the 'check' function return 0 for
-        a triValue that isn't pent or hex. */
-        if (pentN > 0 && hexN > 0)
+        if (listCount == 0)
         {
-            /* If true, we've found the next valid
-            tri, pent, hex number, so record the
-            n values for T_n, P_n, H_n and break
-            the loop:*/
-            triN = n;
-            break;
+            pentHex.next();
+            pentHex.next();
+            const FigurateMatch match{ pentHex.next() };
+
+            /* Print the next tri/pent/hex value to the user: */
+            std::cout << "The next triangular, pentagonal, hexagonal number above 40755 "
+                << "was found to be T_" << calculateTriIndex(match.tIndex) << " = P_" << match.sIndex
+                << " = H_" << match.tIndex << " = " << match.value << ".\n";
         }
     }
-
-
-    /* Exception in the case where we do not find
-    the next number for n <= 1000; i.e. in that
-    case we must increase the upper bound of n in
-    the loop. */
-    try
-    {
-        if (triN == 0)
-            throw "No tri, pent, hex number was found below the upper bound of n.";
-    }
-    catch (const std::string& str)
+    catch (const char* exception)
     {
-        std::cerr << "Error: " << str << '\n';
+        std::cerr << "ERROR " << exception << ".\n";
+        return 1;
     }
 
 
-    /* Print the next tri/pent/hex value to the user: */
-    if (triN > 0 && pentN > 0 && hexN > 0)
-    {
-    std::cout << "The next triangular, pentagonal, hexagonal number above 40755 "
-        << "was found to be T_" << triN << " = P_" << pentN << " = H_" << hexN
-        << " = " << triValue << ".\n";
-    }
-    
-    
     return 0;
-}
\ No newline at end of file
+}
@@ -7,200 +7,162 @@
 // a given number (we'll focus only on integer products here)
 // into a vector where we can identify that a(1) = a(N)
 // (for a vector with N elements), a(1+1) = a(N-1),
-// a(1+2) = a(N-2), etc. 
-
-#include <algorithm> // for std::reverse on std::vector.
+// a(1+2) = a(N-2), etc.
+
+// EDIT: Multiplying every pair a * b and checking each
+// product digit by digit takes about 10^(2n) products for
+// n-digit factors, and the products were kept in an int,
+// which overflows past 4 digits.  Going the other way is
+// much faster: the palindromes themselves are generated in
+// descending order, straight from their first half h (the
+// second half is h reversed, r, see Digits.h), and the
+// first one that is a product of two n-digit numbers is
+// the answer.
+//
+// The product of two n-digit numbers has 2n digits (for
+// n >= 2 at least), so P = h 10^n + r.  Rather than trying
+// divisors of P, write the factors by how far they are
+// below 10^n, a = 10^n - x and b = 10^n - y:
+//     a b = (10^n - (x + y)) 10^n + x y.
+// With the "carry" c = floor(x y / 10^n), matching this to
+// h 10^n + r gives
+//     x + y = 10^n - h + c,    x y = c 10^n + r,
+// so for each c, x and y are the roots of a quadratic, and
+// P is such a product exactly when its discriminant
+// (x + y)^2 - 4 x y is a perfect square (checked exactly
+// with isSquare(), see Polygonal.h) of the right parity,
+// with x, y in range.  The discriminant only decreases
+// from c = 0 until it turns negative (which is where the
+// search for this P stops), and the palindromes near the
+// top only need a few values of c, so every n up to 12
+// takes milliseconds.
+// (The palindrome is a multiple of 11, as every one with
+// an even number of digits is, so one of a and b is too;
+// the quadratic finds them directly, so that never has to
+// be used to narrow a search.)  For n = 1 no 2-digit
+// palindrome works, and the 1-digit ones are simply
+// tried against every factor.
+//
+// The palindromes and discriminants can pass 64 bits (24
+// digits for n = 12), so they are held in 128 bits (see
+// UInt128.h).
+//
+// Usage: Problem4 [n]
+
+#include <cstdint>
 #include <iostream>
-#include <vector> // for std::vector.
 
-// Class to analyze whether a given product of
-// two numbers is a Palindrome:
-class PalindromeProduct
-{
-private:
-	int m_numDigits{};
-	int m_a{};
-	int m_b{};
-	int m_productab{};
-	int m_transformProd{};
-	std::vector<int> m_vector{};  //Length not initialized here.
-
-public:
-	// Normal constructor sets the lgenth of vector
-	// to 6 (i.e. the largest product for 3-digit integers
-	// is 999*999 = 998,001, a six digit number).
-	PalindromeProduct() : m_numDigits{ 3 }, m_a{ 0 }, m_b{ 0 },
-		m_productab{ 0 }, m_transformProd{ 0 }
-	{
-		m_vector.reserve(6);
-	}
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/Digits.h"
+#include "../SharedLibrary/Polygonal.h" // For isSquare().
+#include "../SharedLibrary/UInt128.h"
 
-	// Constructor for abitrary digits:
-	PalindromeProduct(int& numDigit) : m_numDigits{ numDigit },
-		m_a{ 0 }, m_b{ 0 }, m_productab{ 0 },
-		m_transformProd{ 0 }
-	{
-		m_vector.reserve(2 * m_numDigits);
-	}
+// The largest palindrome product found, a * b = product:
+struct PalindromeProduct
+{
+	uint64_t a{};
+	uint64_t b{};
+	UInt128 product{};
+};
 
-	int& getnumDigits() { return m_numDigits; }
-	int& geta() { return m_a; }
-	int& getb() { return m_b; }
-	int& getproductab() { return m_productab; }
-	std::vector<int>& getvector() { return m_vector; }
+// Searches the 2n-digit palindromes, in descending order,
+// for one that is a product of two n-digit numbers; returns
+// false if none is:
+bool findPalindromeProduct(int numDigits, PalindromeProduct& result)
+{
+	uint64_t power{ 1 }; // 10^n
+	for (int i{ 0 }; i < numDigits; ++i)
+		power *= 10;
 
-	void setnumDigits(int& numDig) { m_numDigits = numDig; }
-	void seta(int& a) { m_a = a; }
-	void setb(int& b) { m_b = b; }
+	// x and y go up to 10^n - 10^(n-1), for a, b >= 10^(n-1):
+	const uint64_t maxDeficit{ power - power / 10 };
 
-	int& calculateProductab()
+	for (uint64_t half{ power - 1 }; half >= power / 10; --half)
 	{
-		m_productab = m_a * m_b;
-		return getproductab();
-	}
+		const uint64_t mirror{ reverseDigits(half) };
 
-	void transformProducttoVector()
-	{
-		// First, clear any previous numbers in the vector:
-		m_vector.clear();
-		m_vector.reserve(2 * getnumDigits());
-		// ^^^ SETS CAPACITY OF m_vector, NOT LENGTH!
-
-		// Next, assign new values of number to vector,
-		// which requires transforming the int variable into
-		// the vector form; we use an intermediate variable
-		// for this purpose (transformProd).
-		m_transformProd = m_productab;
-		while (m_transformProd > 0)
+		for (uint64_t carry{ 0 }; ; ++carry)
 		{
-			// This sets vector length according to # of digits
-			// in the product (CAN BE LESS THAN 2*m_numDigits!).
-			m_vector.push_back(m_transformProd % 10);
-			m_transformProd = static_cast<int>(floor(static_cast<double>(m_transformProd) / 10));
-		}
+			const uint64_t sum{ power - half + carry }; // x + y
+			const UInt128 product{ UInt128::multiply(carry, power) + UInt128{ mirror } }; // x y
 
-		// However, note the above loop puts the vector in
-		// backwards order (i.e. its 100,899 for 998,001 right
-		// now), so we need to reverse the order of this vector:
-		std::reverse(m_vector.begin(), m_vector.end());
-		// Now its in its correct form (e.g., 998,001).
-	}
-
-	bool checkPalindrome()
-	{
-		// Use a for loop to check the values for
-		// Palindrome.  Note we only need to check that
-		// vector[0] = vector[5], vector[1] = vector[4]
-		// and vector[2] = vector[3] for 6 digit products, e.g.
-		// BUT, for odd digit numbers, we also will have to say,
-		// e.g., vector[2] = vectpr[2] for a 5 digit product,
-		// so for simplicity we simple check all variations here,
-		// which is notably less efficient.
-		for (int counter1{ 0 }; counter1 < m_vector.size(); ++counter1)
-		{
-			// If they don't match, then its not a Palindrome:
-			if (m_vector[counter1] != m_vector[(m_vector.size() - (counter1 + 1))])
-				return false;
-		}
+			const UInt128 sumSquared{ UInt128::multiply(sum, sum) };
+			const UInt128 fourProduct{ product << 2 };
+			if (sumSquared < fourProduct)
+				break;
 
-		// If loop succeeds, then the product is a Palindrome
-		// and we return true:
-		return true;
-	}
+			uint64_t root{};
+			if (!isSquare(sumSquared - fourProduct, root) || (sum - root) % 2 != 0)
+				continue;
 
-	// Not used, but here is reset (does not reset m_numDigits):
-	void resetPalindromeProduct()
-	{
-		m_a = 0;
-		m_b = 0;
-		m_productab = 0;
-		m_transformProd = 0;
-		m_vector.clear();
-		m_vector.reserve(2 * getnumDigits());
+			const uint64_t x{ (sum + root) / 2 };
+			const uint64_t y{ (sum - root) / 2 };
+			if (y >= 1 && x <= maxDeficit)
+			{
+				result.a = power - y;
+				result.b = power - x;
+				result.product = UInt128::multiply(half, power) + UInt128{ mirror };
+				return true;
+			}
+		}
 	}
-};
 
+	return false;
+}
 
-int main()
+// The same for the (2n - 1)-digit palindromes, which only
+// matter for n = 1, by trying every a >= b:
+bool findShortPalindromeProduct(int numDigits, PalindromeProduct& result)
 {
-	// Initialize the Palindrome product object we'll
-	// be modifying in the loop (for products of 3 digit
-	// numbers):
-	std::cout << "Enter the maximum number of digits "
-		<< "you wish to find the largest palindrome product "
-		<< "of (2 or 3): ";
-	int x{};
-	std::cin >> x;
-
-	PalindromeProduct PalProduct{ x };
-
-	// Need to perform a "backwards" for loop here,
-	// counting down with two counters (the a and b
-	// in the product) from the largest 3-digit number
-	// (999) s.t. we more quickly identify the largest
-	// palindrome product.  Note if we find a palindrome
-	// we can immediately end the loop and print the
-	// palindrome as the result (it will automatically be
-	// the largest palindrome product this way).
-	// In the outer loop (a), we set an a value using the
-	// counter and then run the inner loop (b) for all
-	// b values (999-001, remember we are counting backwards).
-	// In the inner loop (b), we calculate the product ab
-	// and check if it is a palindrome, in which case we break
-	// out of both loops (requires 2 if statements!).  If
-	// it isn't, then we change b and calculate the next 
-	// product and check it, and so on.
-	int counterA{};
-	int counterB{};
-
-	switch (PalProduct.getnumDigits())
-	{
-	case 2: {counterA = 99; counterB = 99; break; }
-	case 3: {counterA = 999; counterB = 999; break; }
-	}
-
-	bool truePal{ false };
+	uint64_t power{ 1 }; // 10^n
+	for (int i{ 0 }; i < numDigits; ++i)
+		power *= 10;
 
-	for (; counterA > 1; --counterA)
+	for (uint64_t half{ power - 1 }; half >= power / 10; --half)
 	{
-		// Set value of a:
-		PalProduct.seta(counterA);
+		const UInt128 palindrome{ UInt128::multiply(half, power / 10) + UInt128{ reverseDigits(half / 10) } };
 
-		for (; counterB > 1; --counterB)
+		for (uint64_t a{ power - 1 }; a >= power / 10 && UInt128::multiply(a, a) >= palindrome; --a)
 		{
-			// Set value of b:
-			PalProduct.setb(counterB);
-
-			// Now calculate ab:
-			PalProduct.calculateProductab();
-
-			// Now we must check if the product is a palindrome:
-			PalProduct.transformProducttoVector();
-
-			if (PalProduct.checkPalindrome())
+			if (palindrome.high() == 0 && palindrome.low() % a == 0 && palindrome.low() / a >= power / 10)
 			{
-				truePal = true;
-				break;
+				result.a = a;
+				result.b = palindrome.low() / a;
+				result.product = palindrome;
+				return true;
 			}
 		}
+	}
 
-		// Required to break free of both loops if
-		// a Palindrome is found:
-		if (truePal)
-		{
-			break;
-		}
+	return false;
+}
+
+int main(int argc, char* argv[])
+{
+	// The number of digits of the factors, 3 by default
+	// (at most 12, so the discriminants stay within 128
+	// bits):
+	uint64_t numDigits{ 3 };
+	if (argc > 1 && !parseArgument(argv[1], 1, 12, numDigits))
+	{
+		std::cerr << "ERROR in main(): the number of digits must be from 1 to 12.\n";
+		return 1;
 	}
 
+	// The 2n-digit palindromes first, then 2n - 1 digits:
+	PalindromeProduct palProduct{};
+	const bool truePal{ findPalindromeProduct(static_cast<int>(numDigits), palProduct)
+		|| findShortPalindromeProduct(static_cast<int>(numDigits), palProduct) };
+
 	if (truePal)
 		std::cout << "The largest palindrome product of two "
-		<< PalProduct.getnumDigits() << " digit numbers (integers) "
-		<< "was found to be: " << PalProduct.geta() << " * "
-		<< PalProduct.getb() << " = " << PalProduct.getproductab()
+		<< numDigits << " digit numbers (integers) "
+		<< "was found to be: " << palProduct.a << " * "
+		<< palProduct.b << " = " << palProduct.product.toString()
 		<< ".\n";
 	else // i.e. we fail to find ANY palindrome, s.t. code is bad:
 		std::cout << "Error: no palindrome product was found."
 		<< '\n';
 
 	return 0;
-}
\ No newline at end of file
+}
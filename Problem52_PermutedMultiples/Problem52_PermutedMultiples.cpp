@@ -25,130 +25,257 @@ than one another (further notice that the
 extract function constructs vectors with
 sizes dependent on this, so a comparison
 using std::equal() should fail).
+
+EDIT: Sorting digit vectors is replaced by comparing digit
+"signatures" from the shared Digits.h (see the
+SharedLibrary): the count of each digit 0-9 packed into
+one uint64_t, so two values have the same digits exactly
+when their signatures are equal (a different number of
+digits gives a different signature too).  2x's signature
+is computed once per x, and nothing is allocated.
+
+EDIT: The x values are now cut into shards which are
+checked on all cores by sweepRange() (see
+SharedLibrary/RangeSweep.h).  Each shard keeps the first
+valid x in it (0 for none), and since the shards are
+combined in order, the first shard with a valid x gives
+the smallest one and ends the search.  It prints the
+progress as it goes and, given a checkpoint file, saves
+how far it got every minute, so searches over much larger
+ranges of x can be stopped and resumed.
+
+EDIT: Most x can be ruled out without looking at their
+digits at all:
+	i) All the multiples need the same number of digits,
+	   so if the smallest multiplier is a and the largest
+	   b (2 and 6 here), x has to lie in a window
+	   10^(k-1) / a <= x <= (10^k - 1) / b for some k.
+	   That is about a third of each power of ten, and
+	   the search jumps straight from one window to the
+	   next.
+	ii) Permuting digits keeps a value's remainder mod 9,
+	   so (b - a) x, and likewise for every multiplier,
+	   has to be a multiple of 9.  For 2, ..., 6 that
+	   means x is a multiple of 9, so only every ninth x
+	   is checked.
+Only then are the signatures compared, the first
+multiplier's computed once and each other one stopping the
+check at the first mismatch.  The multipliers are now an
+argument too (any set of two or more), and x can go as far
+as the largest multiple fits in 64 bits.  Note that the
+checkpoint file does not record the multipliers, so use a
+different file for each set.
+
+Usage: Problem52 [maximum x] [multipliers, e.g. 2,3,4,5,6] [checkpoint file]
 */
 
-#include <algorithm> // for sort(), equal() functions.
+#include <algorithm> // For std::sort(), std::unique(), std::min(), std::max().
+#include <cstddef> // For std::size_t.
 #include <cstdint>
 #include <iostream>
-#include <sstream> // for stringstreams.
-#include <string>
+#include <sstream> // For std::istringstream.
+#include <string> // For std::getline().
 #include <vector>
 
-using largeint_t = int_fast64_t;
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/Digits.h"
+#include "../SharedLibrary/RangeSweep.h"
 
-/* Function to extract digits of an int value
-into a vector: */
-std::vector<int> extractDigitstoVec(const largeint_t& val)
+
+/* The multipliers to check (in increasing order), and the
+step that every valid x has to be a multiple of: */
+struct MultiplierSet
 {
-	std::stringstream valSS{};
-	valSS << val;
-	std::string valStr{};
-	valSS >> valStr;
+	std::vector<uint64_t> multipliers{};
+	uint64_t step{ 1 };
+};
+
 
-	std::vector<int> valVec{};
+/* Function to set up a MultiplierSet.  All the multiples
+are equal mod 9, so 9 has to divide (m - m_0) x for every
+multiplier m; with g the gcd of 9 and all the m - m_0, x
+has to be a multiple of 9 / g: */
+MultiplierSet makeMultiplierSet(std::vector<uint64_t> multipliers)
+{
+	std::sort(multipliers.begin(), multipliers.end());
+	multipliers.erase(std::unique(multipliers.begin(), multipliers.end()), multipliers.end());
 
-	for (int it{0}; it < static_cast<int>(valStr.length()); ++it)
+	uint64_t g{ 9 };
+	for (uint64_t m : multipliers)
 	{
-		/* Requires an implict type-cast from char to int,
-		hence the - '0'. */
-		valVec.push_back(valStr[it] - '0');
+		uint64_t a{ g }, b{ (m - multipliers.front()) % 9 };
+		while (b != 0)
+		{
+			const uint64_t r{ a % b };
+			a = b;
+			b = r;
+		}
+		g = a;
 	}
-	
-	return valVec;
+
+	MultiplierSet set{};
+	set.multipliers = multipliers;
+	set.step = 9 / g;
+	return set;
 }
 
 
-/* Function to determine whether two vector contain
-the same digits by first sorting them and then using
-std::equal(): */
-bool checkSameDigits(const std::vector<int>& vec1, const std::vector<int>& vec2)
+/* Boolean function to check a given x: returns true if
+all its multiples have the same digits. */
+bool checkPermutedMultiples(uint64_t x, const MultiplierSet& set)
 {
-	std::vector<int> temp1{ vec1 };
-	std::vector<int> temp2{ vec2 };
-
-	/* Sort the copied vectors: */
-	sort(temp1.begin(), temp1.end());
-	sort(temp2.begin(), temp2.end());
-
-	/* If these vectors are identical, they contain
-	the same digits, so return true: */
-	if (std::equal(temp1.begin(), temp1.end(), temp2.begin()))
-		return true;
-	else
-		return false;
+	const uint64_t signature1{ digitSignature(set.multipliers.front() * x) };
+
+	/* Now, compare the digit signatures of the others.
+	Note that if we find that they don't have the same
+	digits, we can ignore that x: */
+	for (std::size_t i{ 1 }; i < set.multipliers.size(); ++i)
+	{
+		if (digitSignature(set.multipliers[i] * x) != signature1)
+			return false;
+	}
+
+	return true;
 }
 
 
+/* Function to find the smallest x >= start that is a
+multiple of the step and lies in a window where the
+smallest and largest multiples have the same number of
+digits (windowEnd is set to the end of that window);
+returns 0 if there is none that fits in 64 bits: */
+uint64_t findNextCandidate(uint64_t start, const MultiplierSet& set, uint64_t& windowEnd)
+{
+	const uint64_t smallest{ set.multipliers.front() };
+	const uint64_t largest{ set.multipliers.back() };
+
+	uint64_t power{ 1 }; // 10^(k-1)
+	for (int k{ 1 }; k <= maxDigits; ++k)
+	{
+		/* The largest multiple has at most 20 digits anyway
+		once it fits in 64 bits: */
+		const uint64_t low{ (power + smallest - 1) / smallest };
+		const uint64_t high{ (k < maxDigits) ? (power * 10 - 1) / largest : UINT64_MAX / largest };
+
+		const uint64_t first{ std::max(start, low) };
+		if (first <= high && high - first >= (set.step - first % set.step) % set.step)
+		{
+			windowEnd = high;
+			return first + (set.step - first % set.step) % set.step;
+		}
+
+		if (k < maxDigits)
+			power *= 10;
+	}
+
+	return 0;
+}
 
-int main()
+
+
+int main(int argc, char* argv[])
 {
-	/*
-	First, lets initialize a loop for x values,
-	and the variables for the loops:
-	*/
-	largeint_t mult1{ 2 };
-	largeint_t value1{ 0 };
-	largeint_t value2{ 0 };
-	largeint_t smallestValidx{0};
-	int sameDigitcounter{ 0 };
-	
-
-	for (largeint_t x{ 1 }; x < 1000000; ++x)
-	{	
-		value1 = mult1 * x;
-		
-		/* Now we need a second loop to check multiples in: */
-		for (largeint_t mult2{ 3 }; mult2 <= 6; ++mult2)
+	/* The largest x to check (below one million by
+	default), the multipliers (2 to 6 by default) and the
+	checkpoint file (if any): */
+	uint64_t maxX{ 999999 };
+	if (argc > 1 && !parseArgument(argv[1], 1, UINT64_MAX, maxX))
+	{
+		std::cerr << "ERROR in main(): the maximum x must be a positive whole number.\n";
+		return 1;
+	}
+
+	std::vector<uint64_t> multipliers{ 2, 3, 4, 5, 6 };
+	if (argc > 2)
+	{
+		multipliers.clear();
+		std::istringstream list{ argv[2] };
+		std::string item{};
+		while (std::getline(list, item, ','))
 		{
-			value2 = mult2 * x;
-
-			/* Now, extract these values to vectors
-			   and compare their digits: */
-			if (checkSameDigits(extractDigitstoVec(value1), extractDigitstoVec(value2)))
-			{						
-				/* DEBUG: print when same digits are found:
-				std::cout << "For x = " << x << ", 2x = " << value1 
-					<< " matches " << mult2 << "x = "<< value2 
-					<< " in digits.\n"; */
-
-				/* If they have same digits, increment counter: */
-				++sameDigitcounter;
-			}
-			else
+			uint64_t multiplier{};
+			if (!parseArgument(item.c_str(), 1, UINT64_MAX, multiplier))
 			{
-				/* Note that if we find that they don't
-				have the same digits, we can ignore that x,
-				so break out of this inner for loop: */
-				break;
+				std::cerr << "ERROR in main(): the multipliers must be positive whole numbers, separated by commas.\n";
+				return 1;
 			}
+			multipliers.push_back(multiplier);
 		}
+	}
+	const MultiplierSet set{ makeMultiplierSet(multipliers) };
 
-		/* Only true if all iterations in inner loop
-			increase the counter, i.e. 3x,4x,5x,6x digits 
-			all match 2x digits.  Records x and escapes loop.
-			note since we search x in ascending order, this
-			yields the smallest valid x we are looking for. */
-		if (sameDigitcounter == 4)
-		{
-			smallestValidx = x;
-			break;
-		}
+	if (set.multipliers.size() < 2)
+	{
+		std::cerr << "ERROR in main(): there must be at least two different, positive multipliers.\n";
+		return 1;
+	}
 
-		/* Reset the conditional counter for new x:*/
-		sameDigitcounter = 0;
+	RangeSweepOptions options{};
+	options.checkpointFile = (argc > 3) ? argv[3] : "";
+	options.shardSize = std::max<uint64_t>(maxX / 4096, 1 << 20);
+
+	uint64_t smallestValidx{ 0 };
+	try
+	{
+		/* Each shard's state is the first valid x in it; as
+		we search x in ascending order, the first one found
+		is the smallest valid x we are looking for: */
+		const SweepState found{ sweepRange(1, std::min(maxX, UINT64_MAX / set.multipliers.back()), SweepState{ 0 },
+			[&set](uint64_t first, uint64_t last, SweepState& shard)
+			{
+				uint64_t windowEnd{};
+				for (uint64_t x{ findNextCandidate(first, set, windowEnd) }; x != 0 && x <= last; )
+				{
+					if (checkPermutedMultiples(x, set))
+					{
+						shard[0] = x;
+						break;
+					}
+
+					/* On to the next multiple of the step, or
+					the next window: */
+					if (windowEnd - x >= set.step)
+						x += set.step;
+					else
+						x = (windowEnd == UINT64_MAX) ? 0 : findNextCandidate(windowEnd + 1, set, windowEnd);
+				}
+			},
+			[](SweepState& total, const SweepState& shard)
+			{
+				if (total[0] == 0)
+					total[0] = shard[0];
+			},
+			options,
+			[](const SweepState& total) { return total[0] != 0; }) };
+
+		smallestValidx = found[0];
+	}
+	catch (const char* exception)
+	{
+		std::cerr << "ERROR " << exception << ".\n";
+		return 1;
+	}
+
+	/* Print the multiples as "2x, 3x, ... and 6x": */
+	std::ostringstream multiples{};
+	for (std::size_t i{ 0 }; i < set.multipliers.size(); ++i)
+	{
+		if (i != 0)
+			multiples << ((i + 1 == set.multipliers.size()) ? " and " : ", ");
+		multiples << set.multipliers[i] << 'x';
 	}
 
 	/* If no value was found: */
 	if (smallestValidx == 0)
 	{
-		std::cout << "No positive integer x was found that has "
-			<< "2x, 3x, 4x, 5x, and 6x which contain the same digits.\n";
+		std::cout << "No positive integer x <= " << maxX << " was found that has "
+			<< multiples.str() << " which contain the same digits.\n";
 	}
 	else /* Valid x was found: */
 	{
 		std::cout << "Positive integer x = " << smallestValidx
-			<< " has 2x, 3x, 4x, 5x, and 6x which contain the same digits.\n";
+			<< " has " << multiples.str() << " which contain the same digits.\n";
 	}
 
 	return 0;
-}
\ No newline at end of file
+}
@@ -89,88 +89,83 @@ problem's algorithm works as intended, but I am not convinced that
 overflows do not occur in the numerators and denominators for very 
 late iterations (e.g., i = 1000th expansion likely has very large
 numerator and denominator).
+
+EDIT: They do: the numerators pass 2^63 by the 50th expansion,
+and the 1000th has 383 digits.  The fractions are now the
+convergents h_i / k_i of a ConvergentSequence (see
+SharedLibrary/Convergents.h), held as BigUInt values and
+built from
+	h_i = a_i * h_(i-1) + h_(i-2)
+	k_i = a_i * k_(i-1) + k_(i-2)
+which, with every a_i = 2 after a_0 = 1, is exactly the
+relation above.  This works for any continued fraction (or
+any sqrt(D), via ConvergentSequence::ofSqrt()), so neither
+the sqrt(2)-only iteration nor starting from the known
+8th expansion is needed any more: all expansions from the
+first are checked.
+
+The digit counts are not taken with log10 (or by printing
+the numbers) either.  Since the numerators and denominators
+only ever grow, each keeps the next power of ten it has not
+yet reached, which is almost always a different number of
+limbs and so decided by one size comparison.  Each
+expansion then costs time linear in the length of the
+numbers, so 10^5 expansions (38000+ digits) take under half
+a second (and the 10^7 allowed at most, about an hour).
+
+Usage: Problem57 [maximum expansions]
 */
 
 #include <cstdint>
 #include <iostream>
 
-using lint_t = int_fast64_t;
-
-
-/* Simple fraction class: */
-class Fraction
-{
-private:
-	lint_t m_numer{};
-	lint_t m_denom{};
-
-public:
-	Fraction() : m_numer{0}, m_denom{1}
-	{
-	}
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/Convergents.h"
 
-	Fraction(lint_t numer, lint_t denom) : m_numer{ numer }, m_denom{ denom }
-	{
-	}
-
-	lint_t& getNumer() { return m_numer; }
-	lint_t& getDenom() { return m_denom; }
-
-	void setNumer(const lint_t& numer1) { m_numer = numer1; }
-	void setDenom(const lint_t& denom1) { m_denom = denom1; }
-};
+using lint_t = int_fast64_t;
 
 
-/* Function to calculate the next fractional iteration of the 
-expansion in the continued fraction.  Since we only deal with 
-sqrt(2), here, this is built solely for sqrt(2) expansions.
-Note this may not work for other sqrt(A) because the iteration
-equations may not be the same as these. */
-Fraction calculateNextExpanSqrt2(Fraction& fracIn)
+/* Boolean function to compare the digits of the current
+fraction: returns true if its numerator has more digits
+than its denominator. */
+bool checkNumerDigitsExceedDenom(const ConvergentSequence& fraction)
 {
-	Fraction tempFrac{};
-
-	tempFrac.setNumer( fracIn.getNumer() + 2 * fracIn.getDenom() );
-	tempFrac.setDenom( tempFrac.getNumer() - fracIn.getDenom() );
-
-	return tempFrac;
+	return fraction.getNumeratorDigits() > fraction.getDenominatorDigits();
 }
 
 
-int main()
+int main(int argc, char* argv[])
 {
-	/* Initialize counter and temporary fraction object.
-	Note we initialize this object to the 8th i value: */
-	Fraction frac_ithExp{1393, 985}; // i = 8th expansion.
-	lint_t counterNumDigVsDenomDig{0};
+	/* The maximum number of expansions, 1000 by default: */
+	uint64_t maxi{ 1000 };
+	if (argc > 1 && !parseArgument(argv[1], 1, 10000000, maxi))
+	{
+		std::cerr << "ERROR in main(): the maximum expansions must be from 1 to 10^7.\n";
+		return 1;
+	}
 
 
-	/* Ask user for maximum i-th value for iterations: */
-	std::cout << "Enter the maximum number of expansions for sqrt(2): ";
-	lint_t maxi{};
-	std::cin >> maxi;
+	/* Initialize counter and the convergents of sqrt(2),
+	whose 0-th is a_0 / 1 = 1/1: */
+	ConvergentSequence frac_ithExp{ [](uint64_t i) -> uint64_t { return (i == 0) ? 1 : 2; } };
+	lint_t counterNumDigVsDenomDig{ 0 };
 
 
-	/* For all iterations of i in range, record the number 
+	/* For all expansions i in range, record the number 
 	of fractions which have more digits in numerator than 
 	denominator using the counter: */
-	for (lint_t i{ 8 }; i < maxi; ++i)
+	for (uint64_t i{ 1 }; i <= maxi; ++i)
 	{
-		/* Counts the number of digits of a given fraction 
-		class object.Note this funciton utilizes the reduction
-		via log10 of a large number to output the # of digits 
-		(effectively floors the remainder of 
-		log10(B * 10 ^ n) = n * log10(B), e.g., leaving only 
-		the # of digits(n).  Then compares the digits of
-		numerator against those in denominator, yielding true
-		if digitnum > digitdenom and increasing the counter when
-		true is reached. */
-		if (static_cast<lint_t>(log10(frac_ithExp.getNumer())) > static_cast<lint_t>(log10(frac_ithExp.getDenom())))
+		frac_ithExp.next(); // i-th expansion.
+
+		if (checkNumerDigitsExceedDenom(frac_ithExp))
 		{
 			++counterNumDigVsDenomDig;
 		}
 
-		frac_ithExp = calculateNextExpanSqrt2(frac_ithExp);
+		/* DEBUG: print the first few expansions:
+		if (i <= 8)
+			std::cout << frac_ithExp.getNumerator() << '/' << frac_ithExp.getDenominator() << '\n'; */
 	}
 
 
@@ -181,4 +176,4 @@ int main()
 
 
 	return 0;
-}
\ No newline at end of file
+}
@@ -66,8 +66,10 @@ Also, note that we'll need to be able to identify and extract
 the first and last two digits of 4-digit numbers for comparison
 (using a function) and to generate numbers according to polygonal type
 (using a single function with a switch in it in association with an 
-enum class).  Note we can adapt the function from problem 52 for
-extracting digits to vectors.
+enum class).  (EDIT: no digit extraction is needed after all;
+for a 4-digit number these are just val / 100 and val % 100,
+and polygonalNumber() in SharedLibrary/Polygonal.h covers
+every type, so neither function is kept.)
 
 Furthermore, recall that we only care about 4-digit numbers.
 We thus need to bound all types of polygonal numbers to their largest 
@@ -75,312 +77,290 @@ and smallest n value that produce their largest and smallest 4-digit
 values.  We can determine this using the inverse equations for each 
 polygonal type (noting we only care about values that give whole n 
 integers) for polygonal numbers near (but above) 1000 and near 
-(but below) 9999.  If we do this (shown as debug code here), we get:
+(but below) 9999.  If we do this, we get:
 	Triangular 4-digit bounds: 45 <= n <= 140 
 	Square 4-digit bounds: 32 <= n <= 99 
 	Pentagonal 4-digit bounds: 26 <= n <= 81
 	Hexagonal 4-digit bounds: 23 <= n <= 70
 	Heptagonal 4-digit bounds: 21 <= n <= 63
 	Octagonal 4-digit bounds: 19 <= n <= 58
+(EDIT: buildFigurateGraph() now finds these bounds itself,
+for any number of digits and sides, so the debug code that
+worked them out is gone.)
+
+EDIT: Nesting a loop per type (in one fixed order, or
+through every permutation of the orders) never got to a
+working search.  The search is now done on a graph
+instead:
+	i) Every 4-digit polygonal number of each type is a
+	   node, keyed by its first two digits (its prefix)
+	   and its last two (its suffix).  A node whose suffix
+	   starts with a 0 can't lead on to a 4-digit number,
+	   so it is dropped.
+	ii) The nodes are sorted by prefix, with where each
+	   prefix starts kept in a table, so the nodes that
+	   can follow a node (prefix = its suffix) are one
+	   contiguous run, found without any digit handling.
+	iii) A depth-first search extends a path from each
+	   node of the type with the fewest numbers (any cycle
+	   goes through that type once, so it is found exactly
+	   once), keeping the types used so far as a bitmask,
+	   so any order of the types is tried at once, and
+	   stops at a full path whose last suffix is the first
+	   prefix.  Whether a path can still be completed only
+	   depends on its last suffix and the types used, so
+	   (for each start prefix) the states that led nowhere
+	   are remembered and not searched again.
+This takes microseconds, so the search is generalized to
+k-digit numbers (k even; the last k/2 digits of each
+number are then the first k/2 of the next) and to all the
+s-gonal types for 3 <= s <= s_max, up to s_max = 20.  All
+cycles are counted and the first ten listed.  Note that
+the number of cycles grows very fast with the number of
+types (for 4 digits and s_max = 20 there are over a
+million, which take about a minute to go through).
+
+Usage: Problem61 [k] [s_max]
 */
 
-#include <algorithm> // for next_permutation()
+#include <algorithm> // for std::sort(), std::min_element()
+#include <cstddef> // For std::size_t.
 #include <cstdint>
 #include <iostream>
-#include <sstream> // for stringstream.
+#include <unordered_set>
 #include <vector>
 
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/Polygonal.h"
 
-using lint_t = int_fast32_t;
 
-
-/* Enum class for polygonal number type: */
-enum class PolygonalType
+/* A k-digit s-gonal number, as a node of the graph,
+with its first and last k/2 digits: */
+struct FigurateNode
 {
-	triangular,
-	square,
-	pentagonal,
-	hexagonal,
-	heptagonal,
-	octagonal,
-	max_polygonaltypes
+	uint64_t value{};
+	std::size_t type{}; // Index of s in the list of sides.
+	uint64_t prefix{};
+	uint64_t suffix{};
 };
 
 
-/* Function to generate polygonal numbers according
-to the selected PolygonalType parameter: */
-lint_t calculatePolygonalValue(const lint_t& n, const PolygonalType& poly)
+/* The graph of all numDigits-digit polygonal numbers of
+the given types, sorted by prefix; the nodes with prefix p
+are nodes[firstWithPrefix[p]] up to (not including)
+nodes[firstWithPrefix[p + 1]]: */
+struct FigurateGraph
 {
-	switch (poly)
-	{
-	case PolygonalType::triangular:
-		return ((n * (n + 1)) / 2);
-		break;
-	case PolygonalType::square:
-		return (n*n);
-		break;
-	case PolygonalType::pentagonal:
-		return ((n * (3*n - 1)) / 2);
-		break;
-	case PolygonalType::hexagonal:
-		return (n * (2*n - 1));
-		break;
-	case PolygonalType::heptagonal:
-		return ((n * (5*n - 3)) / 2);
-		break;
-	case PolygonalType::octagonal:
-		return (n * (3*n - 2));
-		break;
-	default: return 0;
-	}
-}
+	std::vector<uint64_t> sides{};
+	std::vector<FigurateNode> nodes{};
+	std::vector<std::size_t> firstWithPrefix{};
+	std::vector<std::size_t> countOfType{};
+};
 
 
-/* Function to extract digits of an int value
-into a vector: */
-std::vector<int> extractDigitstoVec(const lint_t& val)
+/* Function to build the graph for numDigits-digit numbers
+(numDigits even) and the given numbers of sides: */
+FigurateGraph buildFigurateGraph(int numDigits, const std::vector<uint64_t>& sides)
 {
-	std::stringstream valSS{};
-	valSS << val;
-	std::string valStr{};
-	valSS >> valStr;
+	uint64_t half{ 1 }; // 10^(numDigits / 2)
+	for (int i{ 0 }; i < numDigits / 2; ++i)
+		half *= 10;
+	const uint64_t low{ half * half / 10 };
+	const uint64_t high{ half * half - 1 };
 
-	std::vector<int> valVec{};
+	FigurateGraph graph{};
+	graph.sides = sides;
+	graph.countOfType.resize(sides.size());
 
-	for (int it{ 0 }; it < static_cast<int>(valStr.length()); ++it)
+	for (std::size_t type{ 0 }; type < sides.size(); ++type)
 	{
-		/* Requires an implict type-cast from char to int,
-		hence the - '0'. */
-		valVec.push_back(valStr[it] - '0');
+		const uint64_t s{ sides[type] };
+
+		/* Start just below the first n with P_s(n) >= low: */
+		uint64_t n{ isqrt(2 * low / (s - 2)) };
+		n = (n > 1) ? n - 1 : 1;
+
+		for (; ; ++n)
+		{
+			const uint64_t value{ polygonalNumber(s, n).low() };
+			if (value > high)
+				break;
+			if (value < low || value % half < half / 10)
+				continue;
+
+			graph.nodes.push_back(FigurateNode{ value, type, value / half, value % half });
+			++graph.countOfType[type];
+		}
 	}
 
-	return valVec;
-}
+	std::sort(graph.nodes.begin(), graph.nodes.end(),
+		[](const FigurateNode& a, const FigurateNode& b) { return a.prefix < b.prefix; });
 
-/* Boolean function to check the last two digits of one 4-digit
-value against the first two digits in another. Returns true if
-they are the same, false otherwise.  Should not be used on
-values less than 1000 (i.e. sub 4-digit numbers) as this will
-cause an out-of-bounds error! */
-bool checkCyclicPair4digit(const lint_t& val1, const lint_t& val2)
-{
-	/* Extract digits for comparison: */
-	std::vector<int> vec1{ extractDigitstoVec(val1) };
-	std::vector<int> vec2{ extractDigitstoVec(val2) };
+	graph.firstWithPrefix.assign(static_cast<std::size_t>(half) + 1, 0);
+	for (const FigurateNode& node : graph.nodes)
+		++graph.firstWithPrefix[static_cast<std::size_t>(node.prefix) + 1];
+	for (std::size_t p{ 1 }; p < graph.firstWithPrefix.size(); ++p)
+		graph.firstWithPrefix[p] += graph.firstWithPrefix[p - 1];
 
-	/* Compare last two digits of val1 (.at(2) and .at(3)) against
-	first two digits of val2 (.at(0) and .at(1): */
-	if (vec1.at(2) == vec2.at(0) && vec1.at(3) == vec2.at(1))
-		return true;
-	else
-		return false;
+	return graph;
 }
 
 
-/* Debug function determining the bounds 
-of n for each polygonal type. Returns -1 if number
-does not return a valid n for the given polygonal type. */
-/* lint_t calculateNfromVal(const lint_t& val, const PolygonalType& poly)
+/* The state of the depth-first search: the path so far
+(node indices), the cycles found, and the (suffix, used
+types) states already known to lead to no cycle back to
+the current start prefix: */
+struct CyclicSearch
 {
-	double result{};
-
-	switch (poly)
-	{
-	case PolygonalType::triangular:
-		result = ((sqrt(8 * val + 1) - 1) / 2);
-		if (floor(result) == result)
-			return result;
-		else
-			return -1;
-	case PolygonalType::square:
-		result = sqrt(val);
-		if (floor(result) == result)
-			return result;
-		else
-			return -1;
-	case PolygonalType::pentagonal:
-		result = ((sqrt(24 * val + 1) + 1) / 6);
-		if (floor(result) == result)
-			return result;
-		else
-			return -1;
-	case PolygonalType::hexagonal:
-		result = ((sqrt(32 * val + 4) + 2) / 8);
-		if (floor(result) == result)
-			return result;
-		else
-			return -1;
-	case PolygonalType::heptagonal:
-		result = ((sqrt(40 * val + 9) + 3) / 10);
-		if (floor(result) == result)
-			return result;
-		else
-			return -1;
-	case PolygonalType::octagonal:
-		result = ((sqrt(48 * val + 16) + 4) / 12);
-		if (floor(result) == result)
-			return result;
-		else
-			return -1;
-	default: return -1;
-	}
-} */
+	std::vector<std::size_t> path{};
+	std::vector<std::vector<std::size_t>> cycles{};
+	std::unordered_set<uint64_t> deadStates{};
+};
 
 
-int main()
+/* Depth-first search extending the path by every node that
+follows its last node, is of an unused type and is not
+already in it; full cycles are added to the cycles.
+Returns true if nothing can complete the path from here,
+which only depends on the last suffix and the used types,
+unless a node was passed over as a repeat (then the same
+state reached by another path might still work): */
+bool extendCyclicPath(const FigurateGraph& graph, CyclicSearch& search, uint32_t usedTypes)
 {
-	/*
-	DEBUG:
-	Determine the bounds of n for 4-digit nums (1000-9999)
-	for each polygonal type:
-	*/
-	/* std::cout << "Enter the polygonal type (0=tri, 1=square, 2=pent, 3=hex, 4=hept, 5=oct): ";
-	int polytypeint{};
-	std::cin >> polytypeint;
-	PolygonalType polyType{ static_cast<PolygonalType>(polytypeint) }; */
-
-		/* Find lower bound of this: */
-	/* lint_t polyn1{};
-	
-	for (lint_t value{1000}; value<=9999; ++value)
+	const uint32_t allTypes{ (uint32_t{ 1 } << graph.sides.size()) - 1 };
+	const uint64_t suffix{ graph.nodes[search.path.back()].suffix };
+	const uint64_t state{ (suffix << graph.sides.size()) | usedTypes };
+	if (search.deadStates.count(state) != 0)
+		return true;
+
+	bool isDead{ true };
+	const std::size_t begin{ graph.firstWithPrefix[static_cast<std::size_t>(suffix)] };
+	const std::size_t end{ graph.firstWithPrefix[static_cast<std::size_t>(suffix) + 1] };
+
+	for (std::size_t next{ begin }; next < end; ++next)
 	{
-		/* If we get a valid n, its the first valid n in range: */
-		/*if (calculateNfromVal(value, polyType) != -1)
+		const FigurateNode& node{ graph.nodes[next] };
+		const uint32_t typeBit{ uint32_t{ 1 } << node.type };
+		if (usedTypes & typeBit)
+			continue;
+
+		/* Each type needs a different number: */
+		bool isRepeat{ false };
+		for (std::size_t index : search.path)
+			isRepeat = isRepeat || graph.nodes[index].value == node.value;
+		if (isRepeat)
 		{
-			polyn1 = calculateNfromVal(value, polyType);
-			break;
+			isDead = false;
+			continue;
 		}
-	} */
 
-		/* Find upper bound of this: */
-	/* lint_t polyn2{};
-
-	for (lint_t value{ 9999 }; value >= 1000; --value)
-	{ */
-		/* If we get a valid n, its the last valid n in range: */
-		/* if (calculateNfromVal(value, polyType) != -1)
+		search.path.push_back(next);
+		if ((usedTypes | typeBit) == allTypes)
 		{
-			polyn2 = calculateNfromVal(value, polyType);
-			break;
+			/* The cycle has to close back onto the start: */
+			if (node.suffix == graph.nodes[search.path.front()].prefix)
+			{
+				search.cycles.push_back(search.path);
+				isDead = false;
+			}
 		}
+		else if (!extendCyclicPath(graph, search, usedTypes | typeBit))
+			isDead = false;
+		search.path.pop_back();
 	}
 
-	std::cout << "For type " << static_cast<int>(polyType) << ", we have the range "
-		<< polyn1 << " <= n <= " << polyn2 << ".\n"; */
-
-
+	if (isDead)
+		search.deadStates.insert(state);
+	return isDead;
+}
 
-	/* Initialize a vector to contain the set of numbers
-	and variables to calculate the numbers: */
-	std::vector<lint_t> cyclicSet{};
-	cyclicSet.resize( 6 );
 
-	lint_t tempTri{ 0 };
-	lint_t tempSquare{ 0 };
-	lint_t tempPent{ 0 };
-	lint_t tempHex{ 0 };
-	lint_t tempHept{ 0 };
-	lint_t tempOct{ 0 };
+/* Function to find every cyclic set in the graph, each
+once, starting from the type with the fewest numbers: */
+std::vector<std::vector<std::size_t>> findCyclicSets(const FigurateGraph& graph)
+{
+	CyclicSearch search{};
+	if (graph.sides.empty())
+		return search.cycles;
 
-	bool setisFound{ false };
+	const std::size_t startType{ static_cast<std::size_t>(std::min_element(graph.countOfType.begin(),
+		graph.countOfType.end()) - graph.countOfType.begin()) };
 
+	for (std::size_t start{ 0 }; start < graph.nodes.size(); ++start)
+	{
+		if (graph.nodes[start].type != startType)
+			continue;
 
-	/* Yet another alternate method, this time making "dictionary"
-	vectors for each polygonal type, then checking amongst those
-	values for a cyclical set (note again this set doesn't need
-	to be in order, i.e. tri, square, pent, etc.): */
-	std::vector<lint_t> triDictionary{};
-	std::vector<lint_t> squareDictionary{};
-	std::vector<lint_t> pentDictionary{};
-	std::vector<lint_t> hexDictionary{};
-	std::vector<lint_t> heptDictionary{};
-	std::vector<lint_t> octDictionary{};
+		/* Dead states are only dead for one start prefix
+		(the nodes are in prefix order): */
+		if (!search.path.empty() && graph.nodes[search.path.front()].prefix != graph.nodes[start].prefix)
+			search.deadStates.clear();
 
-	/* Set up the dictionaries: */
-	for (lint_t trin{ 45 }; trin <= 140; ++trin)
-	{
-		tempTri = calculatePolygonalValue(trin, PolygonalType::triangular);
-		triDictionary.push_back(tempTri);
+		search.path.assign(1, start);
+		if (graph.sides.size() == 1)
+		{
+			if (graph.nodes[start].suffix == graph.nodes[start].prefix)
+				search.cycles.push_back(search.path);
+		}
+		else
+			extendCyclicPath(graph, search, uint32_t{ 1 } << startType);
 	}
 
-	for (lint_t squaren{ 32 }; squaren <= 99; ++squaren)
-	{
-		tempSquare = calculatePolygonalValue(squaren, PolygonalType::square);
-		squareDictionary.push_back(tempSquare);
-	}
+	return search.cycles;
+}
 
-	for (lint_t pentn{ 26 }; pentn <= 81; ++pentn)
-	{
-		tempPent = calculatePolygonalValue(pentn, PolygonalType::pentagonal);
-		pentDictionary.push_back(tempPent);
-	}
 
-	for (lint_t hexn{ 23 }; hexn <= 70; ++hexn)
-	{
-		tempHex = calculatePolygonalValue(hexn, PolygonalType::hexagonal);
-		hexDictionary.push_back(tempHex);
-	}
+int main(int argc, char* argv[])
+{
+	/* The number of digits (4 by default) and the largest
+	number of sides (octagonal by default): */
+	uint64_t numDigits{ 4 };
+	uint64_t maxSides{ 8 };
 
-	for (lint_t heptn{ 21 }; heptn <= 63; ++heptn)
+	if ((argc > 1 && !parseArgument(argv[1], 2, 12, numDigits)) || numDigits % 2 != 0)
 	{
-		tempHept = calculatePolygonalValue(heptn, PolygonalType::heptagonal);
-		heptDictionary.push_back(tempHept);
+		std::cerr << "ERROR in main(): the number of digits must be even, from 2 to 12.\n";
+		return 1;
 	}
-
-	for (lint_t octn{ 19 }; octn <= 58; ++octn)
+	if (argc > 2 && !parseArgument(argv[2], 3, 20, maxSides))
 	{
-		tempOct = calculatePolygonalValue(octn, PolygonalType::octagonal);
-		octDictionary.push_back(tempOct);
+		std::cerr << "ERROR in main(): the largest number of sides must be from 3 to 20.\n";
+		return 1;
 	}
 
+	std::vector<uint64_t> sides{};
+	for (uint64_t s{ 3 }; s <= maxSides; ++s)
+		sides.push_back(s);
 
-	/* With these dictionaries, we now need to construct lists of
-	all possible permutations in terms of their polygonal natures,
-	i.e. we need to check across the dictionaries for a given
-	order (e.g. (P_3,P_4,P_5,P_6,P_7,P_8) is one such list). 
-	Note we should be able to permute this somehow to get other orders. */
-	std::vector<PolygonalType> polygonalOrder{ PolygonalType::triangular,PolygonalType::square,
-		PolygonalType::pentagonal, PolygonalType::hexagonal, PolygonalType::heptagonal, PolygonalType::octagonal };
-	
-	lint_t cyclicIter{ 0 }; // Iterator for cyclicset positions.
+	const FigurateGraph graph{ buildFigurateGraph(static_cast<int>(numDigits), sides) };
+	const std::vector<std::vector<std::size_t>> cycles{ findCyclicSets(graph) };
 
-
-	/* Need to progress through all permutations of this vector, so: */
-	do
+	/* Print each set (the first ten, if there are more),
+	with the type of each number, and its sum: */
+	const std::size_t maxPrinted{ 10 };
+	for (std::size_t it1{ 0 }; it1 < cycles.size() && it1 < maxPrinted; ++it1)
 	{
-		for (PolygonalType ptype : polygonalOrder)
-		{
-			cyclicSet.at(cyclicIter) = 0;
-			++cyclicIter;
-		}
-
-		cyclicIter = 0;
-	} while (std::next_permutation(polygonalOrder.begin(), polygonalOrder.end()));
-
+		const std::vector<std::size_t>& cycle{ cycles[it1] };
+		uint64_t totalSum{ 0 };
 
-	/* DEBUG: Print the set of numbers: */
-	std::cout << "( ";
-	for (lint_t it2{0}; it2 < cyclicSet.size(); ++it2)
-	{
-		if (it2 != (cyclicSet.size() - 1))
-			std::cout << cyclicSet.at(it2) << ", ";
-		else
-			std::cout << cyclicSet.at(it2);
-	}
-	std::cout << ")\n";
+		std::cout << "( ";
+		for (std::size_t it2{ 0 }; it2 < cycle.size(); ++it2)
+		{
+			const FigurateNode& node{ graph.nodes[cycle[it2]] };
+			totalSum += node.value;
 
-	/* Now return the sum of these numbers to the user: */
-	lint_t totalSum{ 0 };
+			std::cout << node.value << " [P_" << graph.sides[node.type] << "]";
+			if (it2 != (cycle.size() - 1))
+				std::cout << ", ";
+		}
+		std::cout << " )\n";
 
-	for (lint_t b : cyclicSet)
-	{
-		totalSum += b;
+		std::cout << "The sum of all cyclic numbers in this polygonal set yields "
+			<< totalSum << ".\n";
 	}
 
-	std::cout << "The sum of all cyclic numbers in the "
-		<< "polygonal set (Tri, Square, Pent, Hex, Hept, Oct) yields "
-		<< totalSum << ".\n";
-	
+	std::cout << "Found " << cycles.size() << " cyclic set(s) of " << numDigits
+		<< "-digit numbers, one of each s-gonal type for 3 <= s <= " << maxSides << ".\n";
 
 	return 0;
-}
\ No newline at end of file
+}
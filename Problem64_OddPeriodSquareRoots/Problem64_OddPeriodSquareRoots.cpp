@@ -65,49 +65,58 @@ Problem 57, which deals with a simplier case of continued
 fractions but specifically for sqrt(2) expansion.
 However, this solution therein is not really translatable
 to her as the iteration equations are different.
+
+EDIT: Rather than expanding to some "reasonable maximum" i
+and searching the a_i for repeats, the expansion is now done
+exactly, in integers only (see SharedLibrary/ContinuedFraction.cpp).
+At every step sqrt(D) - ... is kept in the form
+(sqrt(D) + m) / d, and with a_0 = floor(sqrt(D)), m_0 = 0
+and d_0 = 1:
+	m_(i+1) = d_i * a_i - m_i
+	d_(i+1) = (D - m_(i+1)^2) / d_i
+	a_(i+1) = floor((a_0 + m_(i+1)) / d_(i+1))
+(the divisions are always exact, or floored for a_i).  The
+period ends exactly at the first a_i = 2 a_0, so no repeats
+need to be searched for at all.
+
+For counting, the expansion need not even be stored.  The
+(m, d) pairs of one period read the same forwards and
+backwards, so the period length can be told at its middle
+(two equal m in a row: even; two equal d in a row: odd),
+which halves the work.  The D values are then handed out in
+chunks to one thread per core.  All D <= 10^7 take about a
+minute of CPU time (N^1.5 growth), so a few seconds on a
+many-core machine.  maxN is capped at 10^10 (which would
+already take a day or so).
+
+Usage: Problem64 [maxN]
 */
 
 #include <cstdint>
 #include <iostream>
-#include <vector>
 
-using lint_t = int_fast64_t;
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/ContinuedFraction.h"
 
 
-/* Function to solve a continued fraction expansion
-out to the i-th convergence. Returns a vector of
-a_i values that solve the fraction for a given n. */
-std::vector<lint_t> calculateithContFract(const lint_t& n, const lint_t& i)
+int main(int argc, char* argv[])
 {
-	std::vector<lint_t> aitempVec{};
-
-	for (lint_t it{ 0 }; it < i; ++it)
+	/* The maximum N, 10000 by default: */
+	uint64_t maxN{ 10000 };
+	if (argc > 1 && !parseArgument(argv[1], 1, 10000000000, maxN))
 	{
-		;
+		std::cerr << "ERROR in main(): maxN must be from 1 to 10^10.\n";
+		return 1;
 	}
 
-	return aitempVec;
-}
 
+	/* Count the continued fractions with odd period,
+	over all cores: */
+	const uint64_t oddPeriodCounter{ countOddSqrtPeriods(maxN) };
 
-/* Boolean function to check if a given set of a_i values
-has odd periodicity.  Returns true if the periodicity is
-an odd value (i.e. if period % 2 != 0), false otherwise. */
-bool checkAiOddPeriod(const std::vector<lint_t>& aiVec)
-{
-	if (true)
-		return true;
-	else
-		return false;
-}
-
-
-int main()
-{
-	/*
-	d
-	*/
+	std::cout << "There are " << oddPeriodCounter
+		<< " continued fractions with an odd period for N <= " << maxN << ".\n";
 
 
 	return 0;
-}
\ No newline at end of file
+}
@@ -94,108 +94,97 @@ For clarity, this algorithm is:
 	this program will now be altered to incorporate this
 	method.
 
+	EDIT: This is now done (see SharedLibrary/Pell.cpp).  The
+	x and y loops above were up to 10^9 checks per D, and
+	worse, they missed every minimal x over 10^5 (D = 61
+	already needs x = 1766319049), so the "maximum" x found
+	was wrong anyway.  The expansion of sqrt(D) is done with
+	the same integer recurrence as in Problem 64, and with
+	l the period length, the convergent h_(l-1) / k_(l-1)
+	(or h_(2l-1) / k_(2l-1) for an odd l, since the first
+	one only solves x^2 - D * y^2 = -1) is the minimal
+	(x, y).  The convergents grow to thousands of digits
+	for larger D, so they are kept as BigUInt values, each
+	new one being a_i * (previous) + (the one before), done
+	in place.
+
+	Comparing all those x values would still mean building
+	every one of them, so instead each D is first ranked by
+	log10(x) alone: going round one period multiplies
+	x + y * sqrt(D) by (m_i + sqrt(D)) / d_i at each step,
+	so its logarithm is a plain sum of O(l) doubles.  Only
+	the D values whose log10(x) is within rounding of the
+	largest are then solved exactly.  The D values are
+	split among all cores; D <= 10^5 takes well under a
+	second.  maxD is capped at 10^7, which takes a few
+	minutes (the periods grow like sqrt(D)).
+
+	Usage: Problem66 [maxD]
+
 */
 
-#include <algorithm>
 #include <cstdint>
 #include <iostream>
-#include <vector>
+#include <string> // For std::string.
 
-using lint_t = int_fast64_t;
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/BigUInt.h"
+#include "../SharedLibrary/Pell.h"
 
 
 /* Boolean function that checks the Diophantine equation
-for a given D, x, and y.  Returns true if the Diophantine
-equation for those values is satisfied. */
-bool checkDiophantineEqn(const lint_t& d1, const lint_t& x1, const lint_t& y1)
+for a given solution.  Returns true if x^2 - D * y^2 = 1
+for its D, x, and y. */
+bool checkDiophantineEqn(const PellSolution& solution)
 {
-	if (((x1 * x1) - (d1 * (y1 * y1))) == 1)
-		return true;
-	else
-		return false;
+	return (solution.x * solution.x) == (solution.y * solution.y) * solution.D + BigUInt{ 1 };
 }
 
 
-int main()
+int main(int argc, char* argv[])
 {
-	/* Ask for the maximum value of D to generate a range
-	of D values for: */
-	std::cout << "Enter the maximum value for D in the Diophantine equations: ";
-	lint_t maxD{};
-	std::cin >> maxD;
-
-
-	/* Construct the vector for the range of D values: */
-	std::vector<lint_t> dRange{};
-	
-	for (lint_t a{ 1 }; a <= maxD; ++a)
+	/* The maximum value of D, 1000 by default (D = 2 is
+	the first that is not a square): */
+	uint64_t maxD{ 1000 };
+	if (argc > 1 && !parseArgument(argv[1], 2, 10000000, maxD))
 	{
-		/* If D is square, it's square root is a whole number.
-		This statement will fail, then, for such D values, and
-		therefore those values are ignored. */
-		if (sqrt(static_cast<double>(a)) != floor(sqrt(static_cast<double>(a))))
-		{
-			dRange.push_back(a);
-		}
+		std::cerr << "ERROR in main(): maxD must be from 2 to 10^7.\n";
+		return 1;
 	}
 
 
-	/* Now we initialize the vector for x values 
-	and set up two for loops (one for x, one for y)
-	starting from 1. */
-	std::vector<lint_t> minXValues{};
-	bool xisFound{ false };
+	/* DEBUG: print the minimal solutions for small D:
+	for (uint64_t d{ 2 }; d <= 13; ++d)
+	{
+		const PellSolution solution{ solvePell(d) };
+		std::cout << "For D = " << d << ", min x = " << solution.x << ", y = " << solution.y
+			<< " (log10(x) ~ " << pellSize(d).log10X << ").\n";
+	} */
 
 
-	for (lint_t d : dRange)
-	{
-		for (lint_t x{ 1 }; x <= 100000; ++x)
-		{
-			for (lint_t y{ 1 }; y <= 10000; ++y)
-			{
-				if ( checkDiophantineEqn(d, x, y) )
-				{
-					minXValues.push_back(x);
-					xisFound = true;
-				}
-
-				if (xisFound == true)
-				{
-					break;
-				}
-			}
-			
-			if (xisFound == true)
-			{
-				break;
-			}
-		}
-	
-		/* Reset xisFound for next D value: */
-		xisFound = false;
-	}
+	/* Find the D with the largest minimal x, over all cores: */
+	const PellSolution maxXSolution{ largestMinimalPellX(maxD) };
 
-	/* DEBUG: print the contents of the x and D vectors:
-	for (lint_t it{0}; it < dRange.size(); ++it)
+	if (!checkDiophantineEqn(maxXSolution))
 	{
-		std::cout << "For D = " << dRange.at(it) << ", min x = " << minXValues.at(it) << ".\n";
-	} */
-
+		std::cerr << "ERROR in main(): x^2 - D * y^2 != 1 for D = " << maxXSolution.D << ".\n";
+		return 1;
+	}
 
-	/* We now have the full x vector, so find the
-	maximum value of x in that vector and record it's value
-	and its position in the vector:*/
-	lint_t maxXposition{ distance(minXValues.begin(), std::max_element(minXValues.begin(), minXValues.end())) };
-	lint_t maxXValue{ minXValues.at(maxXposition) };
-	lint_t maxXDValue{ dRange.at(maxXposition) };
 
-	
 	/* Now report the value of max x and associated D
-	yielding the maximum x in that range of D: */
+	yielding the maximum x in that range of D (the x
+	itself only if it is of a printable size): */
+	const std::string maxXValue{ maxXSolution.x.toString() };
+
 	std::cout << "For the range D <= " << maxD << ", the maximum value of x in the minimized "
-		<< "Diophantine equations is " << maxXValue << " corresponding to D = " << maxXDValue
-		<< ".\n";
+		<< "Diophantine equations is ";
+	if (maxXValue.size() <= 100)
+		std::cout << maxXValue;
+	else
+		std::cout << "a " << maxXValue.size() << "-digit number";
+	std::cout << " corresponding to D = " << maxXSolution.D << ".\n";
 
 
 	return 0;
-}
\ No newline at end of file
+}
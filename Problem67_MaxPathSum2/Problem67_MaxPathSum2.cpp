@@ -56,96 +56,130 @@ itself.
 We can then continue this going up each level in the triangle
 until we reach the top row, which will yield our final sum in
 the end.
+
+EDIT: The same recurrence also works top-down: going down
+the triangle, the best sum of a path from the apex to entry
+j of a row is that entry plus the larger of the best sums
+to its two parents (entries j - 1 and j of the row above).
+The answer is then the largest best sum in the bottom row.
+Going this way round means each row only needs the best sums
+of the row above, so the triangle can be read once, front to
+back, straight off disk without ever being stored.
+
+Thus, the file is now memory-mapped (see MappedFile in the
+SharedLibrary) and its integers are pulled out with a small
+hand-written scanner into a rolling row of int64 sums (see
+MaxPathSumRow).  Memory use is
+O(rows) rather than O(rows^2), and the sums cannot overflow
+for any realistic triangle (e.g. 10^5 rows, 5*10^9 entries).
+Row r is simply the next r + 1 integers, so the line breaks
+in the file do not matter.
+
+EDIT: Each row is now collected whole and then combined
+with the sums above it by one call to maxPlusRow(), a row
+kernel shared with problem 18.  With AVX2 enabled (as in the
+x64 Release build) it handles 4 int64 sums (8 int32) per
+instruction.  The sums are kept shifted one place right,
+between two very negative sentinels, so the ends of each
+row need no special case.  For triangles so wide that a row
+is tens of thousands of entries, MaxPathSumRow can also
+split each row over a pool of threads (see MaxPlusRowPool).
+
+EDIT: Parsing the text is by now most of the run time, so a
+triangle can also be converted once (packTriangleFile()) to
+a packed binary file: a 16-byte header (magic bytes and the
+row count) followed by every row as int32 values.  Such a
+file is mapped and its rows fed to the DP as they lie, with
+no parsing at all; maxPathSumFromFile() tells the two
+formats apart by the magic bytes.
+
+The solver can also report WHICH path gives the maximum.
+With path tracking on, every entry of every row stores one
+bit saying which of its two parents it took its best sum
+from (rows^2/2 bits in all, 1.25 kB here).  Starting from
+the best entry of the bottom row, these bits lead straight
+back up to the apex.  As that is O(rows^2) memory again
+(about 625 MB for 10^5 rows) and keeps rows from being
+split over threads, it is only done when asked for; by
+default only the sum is found, with wide rows split over
+one thread per core.
+
+Usage: Problem67 [triangle file] [threads, 0 = one per core]
+    [1 to report the path] [packed file to write]
 */
 
 
 #include <cstdint>
 #include <iostream>
-#include <fstream> // For file reading via ifstream.
 #include <string>
-#include <sstream>
 #include <vector>
 
-
-using lint_t = int_fast16_t;
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/MaxPathSum.h"
 
 
-/* Function to extract a given line into a vector of ints: */
-std::vector<lint_t> extractsIntsfromTextLine(const std::string& str)
+int main(int argc, char* argv[])
 {
-    /* Takes one line into an istream class: */
-    std::istringstream stm(str);
-
-    /* Using iterators, convert string to lint_t vector and
-    return it: */
-    using iterator = std::istream_iterator<lint_t>;
-
-    std::vector<lint_t> seg{ iterator(stm), iterator() };
-
-    return seg;
-}
-
-
-/* Input function to read in a number triangle
-from a .txt file: */
-std::vector<std::vector<lint_t>> readInputNumTriang(const std::string& filename)
-{
-    /* Open the .txt file for input: */
-    std::ifstream datafile;
-    datafile.open(filename);
-    
+    /* The triangle file (text or packed) may be given on
+    the command line, then the number of threads to split
+    wide rows over (0, the default, uses one per core) and
+    whether to track the path (off by default, as it needs
+    rows^2/16 bytes): */
+    const std::string filename{ (argc > 1) ? argv[1] : "p67_NumTriangle.txt" };
+
+    uint64_t numThreads{ 0 };
+    if (argc > 2 && !parseArgument(argv[2], 0, 1024, numThreads))
+    {
+        std::cerr << "ERROR in main(): the number of threads must be from 0 to 1024.\n";
+        return 1;
+    }
 
-    /* Begin pushing each line as a vector of
-    lint_t values: */
-    std::string line{};
-    std::vector<std::vector<lint_t>> inputTriang{};
+    uint64_t showPath{ 0 };
+    if (argc > 3 && !parseArgument(argv[3], 0, 1, showPath))
+    {
+        std::cerr << "ERROR in main(): the path option must be 0 or 1.\n";
+        return 1;
+    }
 
-    if (datafile.is_open())
+    try
     {
-        while (getline(datafile, line))
+        /* Optionally convert it to the packed binary format: */
+        if (argc > 4)
         {
-            inputTriang.push_back(extractsIntsfromTextLine(line));
+            const int_fast64_t packedRows{ packTriangleFile(filename, argv[4]) };
+            std::cout << "Packed " << packedRows << " rows into " << argv[4] << ".\n";
         }
-    }
-
-
-    return inputTriang;
-}
 
+        /* Stream the number triangle from the file, running
+        the sub-triangle algorithm as we go: */
+        int_fast64_t numRows{};
+        std::vector<int_fast64_t> path{};
+        const pathsum_t maxSum{ maxPathSumFromFile(filename, numRows,
+            static_cast<unsigned>(numThreads), (showPath != 0) ? &path : nullptr) };
 
-int main()
-{
-	/* Initialize the number triangle by using
-    functions to read from the .txt file: */
-    std::vector<std::vector<lint_t>> numberTriang{
-        readInputNumTriang("p67_NumTriangle.txt") };
 
+        /* Report the final sum to the user: */
+        std::cout << "The maximum possible total from pathing through the "
+            << "given number triangle (" << numRows << " rows) was found to be: "
+            << maxSum << ".\n";
 
-    /* Use the sub-triangle algorithm to modify numberTriang
-    and calculate the maximum sum.
-    Utilizes the std::max() function.for comparison of elements: */
-    for (int currentRow{ static_cast<int>(numberTriang.size()) - 2 }; currentRow >= 0; currentRow--)
-    {
-        for (int currentPos{ 0 }; currentPos <= currentRow; currentPos++)
+        if (!path.empty())
         {
-            /* This is checking the condition of the sub-triangle,
-            i.e. replacing the value a with a + max(b,c) for each
-            sub-triangle in the overall problem.  Note this is done
-            for all a in a given row s.t. we ensure we check all
-            existing paths, effectively, without calculating the
-            actual total sum of each path. */
-            numberTriang.at(currentRow).at(currentPos)
-                += std::max(numberTriang.at(currentRow + 1).at(currentPos),
-                    numberTriang.at(currentRow + 1).at(currentPos + 1));
+            std::cout << "The path ends at entry " << path.back()
+                << " (counting from zero) of the bottom row.\n";
         }
-    }
-
 
-    /* Report the final sum to the user: */
-    std::cout << "The maximum possible total from pathing through the "
-        << "given number triangle was found to be: "
-        << numberTriang.at(0).at(0) << ".\n";
+        /* DEBUG: the entry taken in every row: */
+        /* for (int_fast64_t column : path)
+            std::cout << column << ' ';
+        std::cout << '\n'; */
+    }
+    catch (const char* exception)
+    {
+        std::cerr << "ERROR " << exception << ".\n";
+        return 1;
+    }
 
 
-	return 0;
-}
\ No newline at end of file
+    return 0;
+}
@@ -48,6 +48,13 @@ of a boolean vector won't be an issue here, and I had issues implementing
 a proper means of using sqrt(maxn) as the upper bound of this vector in
 terms of the last for loop (the prime multiplication part).  It may be
 possible, but we avoid that complexity here.
+
+EDIT: The primes now come from the shared ArithmeticSieve
+(see the SharedLibrary, also used by problems 70 and 72),
+asked for no tables beyond its list of primes, so the
+product is simply taken over that list in order.  (The
+odd-only sieve above also missed crossing off i * j = maxn
+and needed 1 and 2 handled by hand.)
 */
 
 
@@ -55,6 +62,8 @@ possible, but we avoid that complexity here.
 #include <iostream>
 #include <vector>
 
+#include "../SharedLibrary/ArithmeticSieve.h"
+
 
 using lint_t = int_fast32_t;
 
@@ -67,61 +76,20 @@ int main()
 	std::cin >> maxn;
 
 
-	/* Initialize a boolean vector to identify primes from, and the
+	/* Generate the primes up to maxn, and initialize the
 	variable for multiplying primes: */
-	std::vector<bool> primeBoolVec((maxn + 1), true);
-	primeBoolVec.at(0) = false; // .at(0) represents zero.
-		// NOTE this is from 0 to maxn! i.e. primeBoolVec.at(0) represents 0.
-	lint_t result{2}; // Note this is accounting for the prime 2.
-
-
-	/* Modify boolean vector to set non-primes to false.  Note
-	this explicitly ignores all even values (but note 1,2 needs to
-	manually included above).  Also note we can exclude factors
-	greater than sqrt(maxn). */
-		/* Note we must exclude even values beyond 2 entirely, so
-		starting at 4 (i.e. position 4, the 5th element in vector): */
-	for (lint_t a{ 4 }; a <= maxn; a += 2)
-	{
-		primeBoolVec.at(a) = false;
-	}
-		/* Now we deal with remaining (odd) values: */
-	for (lint_t i{3}; i * i < maxn; i += 2)
-	{
-		for (lint_t j{ 3 }; j * i < maxn; j += 2)
-		{
-			/* At any non-prime number generated by these loops: */
-			primeBoolVec.at(j * i) = false;
-		}
-	}
+	const ArithmeticSieve sieve(static_cast<uint32_t>(maxn), 0);
+	lint_t result{ 1 };
 
 
-	/* DEBUG: Print the vector: */
-	/* std::cout << "( ";
-	for (bool a : primeBoolVec)
+	/* Now we perform the multiplication with successive
+	primes until we find the largest number below maxn: */
+	for (uint32_t p : sieve.getPrimes())
 	{
-		std::cout << a << " ";
-	}
-	std::cout << ")\n"; */
-
+		if (result * p > maxn)
+			break;
 
-	/* Now we perform the multiplication until we find
-	the largest number below maxn.  Note we must use an 
-	external counter here for the while loop: */
-	lint_t p{ 3 }; // counter for while loop.
-
-	while (result * p <= maxn)
-	{
-		/* If p is a prime, multiply the result by it: */
-		if (primeBoolVec.at(p) == true)
-		{ 
-			result *= p;
-		}
-		
-
-		/* Increment counter by two since all even values 
-		besides 2 will return false anyway: */
-		p += 2;
+		result *= p;
 	}
 
 
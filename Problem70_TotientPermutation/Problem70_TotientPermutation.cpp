@@ -118,175 +118,125 @@ different values than what I get here, but I cannot for the life
 of me identify how they are correct over this code.  Be aware,
 then, this code may be wrong in a way I cannot for the life of
 me identify.
+
+EDIT: The prime list generator from problem 10 is replaced
+by the shared ArithmeticSieve (see the SharedLibrary, also
+used by problems 69 and 72), a linear sieve which also fills
+in phi(n) for every n up to maxN in the same pass, so
+phi(p_1 * p_2) is now read straight from its table.
+
+EDIT: Found it.  The best n for 10^7 is 8319823 = 2339 * 3557,
+and 3557 lies just outside the 2001-3500 window searched
+above, so the "close to sqrt(n)" heuristic was simply too
+narrow.  Rather than guess a better window, the search is
+now exhaustive: every n in 1 < n < maxN is checked, with
+phi(n) from the segmented totient sieve in the SharedLibrary
+(which only keeps the primes up to sqrt(maxN) plus one small
+window of phi values per thread, so maxN = 10^9 needs a few
+MB).  The windows are sieved on every core and handed over
+in order, and for each n:
+	1) n/phi(n) is compared against the best ratio so far
+	as n * bestPhi < bestN * phi(n) (exact, no floating
+	point; the products are taken in 128 bits).  Almost every
+	n fails here, so the rest is rarely reached.
+
+	2) A permutation has the same digit sum, so n and phi(n)
+	must agree mod 9.
+
+	3) Finally the digits are compared as "signatures" (see
+	digitSignature() in the shared Digits.h): the count of
+	each digit 0-9 packed into 6-bit fields of one
+	uint64_t.  Two numbers are permutations of each other
+	exactly when their signatures are equal, so there is no
+	string, vector or sort involved.
+Since every n is looked at, the answer is guaranteed
+rather than heuristic.  (Ties in n/phi(n) keep the
+smaller n.)  maxN is capped at 10^12, which would already
+take hours.
+
+Usage: Problem70 [maxN]
 */
 
 
-#include <algorithm> // for sort() and equal()
 #include <cstdint>
 #include <iostream>
-#include <sstream> // for stringstream classes.
-#include <string>
-#include <vector>
-
-
-using lint_t = int_fast64_t; 
-// Needed as n could have as many as 8 digits
 
-
-/* Function to generate a boolean vector of primes below
-a given maximum value (maxN). Uses the sieve method
-detailed in problem 10: */
-std::vector<bool> generatePrimeList(const lint_t& maxN)
-{
-	std::vector<bool> primes((maxN + 1), true); // calls vec constructor here.
-	primes.at(0) = false; // Set zero to false (non-prime);
-	primes.at(1) = false; // Set one to false (non-prime);
-
-
-	/* Now sieve out non-primes, starting with all multiples
-	of 2: */
-	for (lint_t a{ 4 }; a <= maxN; a += 2)
-	{
-		primes.at(a) = false;
-	}
-	/* Now for all other non-primes; including multiples of 3.
-	Note the conditions p*p > maxN is included here: */
-	for (lint_t i{ 3 }; i * i < maxN; i += 2)
-	{
-		for (lint_t j{ 3 }; j * i < maxN; j += 2)
-		{
-			primes.at(j * i) = false;
-		}
-	}
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/Digits.h"
+#include "../SharedLibrary/SegmentedTotientSieve.h"
+#include "../SharedLibrary/UInt128.h"
 
 
-	return primes;
-}
+using lint_t = uint64_t;
+// Needed as n could have as many as 10 digits
 
 
-/* Function to extract digits of an int value
-into a vector: */
-std::vector<int> extractDigitstoVec(const lint_t& val)
+int main(int argc, char* argv[])
 {
-	std::stringstream valSS{};
-	valSS << val;
-	std::string valStr{};
-	valSS >> valStr;
-
-	std::vector<int> valVec{};
-
-	for (int it{ 0 }; it < static_cast<int>(valStr.length()); ++it)
+	/* The (exclusive) upper bound for n, 10^7 by default: */
+	lint_t maxN{ 10000000 };
+	if (argc > 1 && !parseArgument(argv[1], 2, 1000000000000, maxN))
 	{
-		/* Requires an implict type-cast from char to int,
-		hence the - '0'. */
-		valVec.push_back(valStr[it] - '0');
+		std::cerr << "ERROR in main(): maxN must be from 2 to 10^12.\n";
+		return 1;
 	}
 
-	return valVec;
-}
-
 
-/* Function to determine whether two vector contain
-the same digits by first sorting them and then using
-std::equal(): */
-bool checkSameDigits(const std::vector<int>& vec1, const std::vector<int>& vec2)
-{
-	std::vector<int> temp1{ vec1 };
-	std::vector<int> temp2{ vec2 };
-
-	/* Sort the copied vectors: */
-	sort(temp1.begin(), temp1.end());
-	sort(temp2.begin(), temp2.end());
-
-	/* If these vectors are identical, they contain
-	the same digits, so return true: */
-	if (std::equal(temp1.begin(), temp1.end(), temp2.begin()))
-		return true;
-	else
-		return false;
-}
-
-
-int main()
-{
-	/* DEBUG: checking sqrt(n) values: */
-	/*std::cout << sqrt(13) << '\n';
-	std::cout << static_cast<lint_t>(round(sqrt(13))) << '\n'; */
-
-
-	/* The maximum upper bound for n here is 10^7: */
-	lint_t maxN{10000000};
-
-
-	/* Generate list of primes: */
-	std::vector<bool> primes{ generatePrimeList(maxN) };
-
-
-	/* Now find the minimized totient that is also
-	a permutation of n: */
-	lint_t totientN{ 1 };
+	/* Now find the minimized n/phi(n) for which phi(n)
+	is a permutation of n, over every n in range: */
+	lint_t finalN{ 0 };
 	lint_t finaltotientN{ 1 };
-	lint_t currentN{ 1 };
-	lint_t finalN{ 1 };
-	bool largestPrimesPermuteFound{ false };
-	long double nphin{0.0};
-	long double finalnphin{ 0.0 };
-
-	/* Note these two loops count up to find the best option. */
-		/* Identify two largest distinct prime divisors around sqrt(maxN): */
-	for (lint_t primeit1{ 2001 }; primeit1 <= 3500; primeit1 += 2)
+
+	try
 	{
-		for (lint_t primeit2{ primeit1 + 2 }; primeit2 <= 3500; primeit2 += 2)
+		if (maxN > 3)
 		{
-			/* Excludes non-primes and non-disinct pairs of primes: */
-			if (primes.at(primeit1) == true && primes.at(primeit2) == true
-				&& primeit1 != primeit2)
-			{
-				/* Also ignore any N above maxN: */
-				if ((primeit1 * primeit2) < maxN)
+			sieveTotientWindows(2, maxN - 1,
+				[&](uint64_t first, const uint64_t* phi, std::size_t count)
 				{
-					/* CurrentN, totientN, and nphin are replaced for the
-					currently largest prime divisors: */
-					currentN = primeit1 * primeit2;
-					totientN = (primeit1 - 1) * (primeit2 - 1);
-					nphin = (static_cast<long double>(currentN) / totientN);
-
-					/* Now check that n and phi(n) are permutations: */
-					if (checkSameDigits(extractDigitstoVec(currentN), extractDigitstoVec(totientN))
-						&& nphin < std::numeric_limits<long double>::infinity())
+					for (std::size_t i{ 0 }; i < count; ++i)
 					{
-						/* Only executes if we both get a permutation
-						and minimize n/phi(n) and saves the proper final
-						answer.  Note this will execute for each such
-						case until we find the highest one (i.e. one
-						with two largest distinct prime divisors). */
-						finalN = currentN;
-						finaltotientN = totientN;
-						finalnphin = nphin;
-						largestPrimesPermuteFound = true;
+						const lint_t currentN{ first + i };
+						const lint_t totientN{ phi[i] };
+
+						/* Only executes if we both minimize n/phi(n) and
+						get a permutation: */
+						if ((finalN == 0
+							|| UInt128::multiply(currentN, finaltotientN) < UInt128::multiply(finalN, totientN))
+							&& (currentN - totientN) % 9 == 0
+							&& digitSignature(currentN) == digitSignature(totientN))
+						{
+							finalN = currentN;
+							finaltotientN = totientN;
+						}
 					}
-				}
-			}
+				}, 0);
 		}
 	}
+	catch (const char* exception)
+	{
+		std::cerr << "ERROR " << exception << ".\n";
+		return 1;
+	}
 
 
-	/* Note if largestPrimePermuteFound is false by
-	this point, we didn't find what we're looking for,
-	so return error to user: */
-	if (!largestPrimesPermuteFound)
+	/* Note if finalN is still zero by this point, we
+	didn't find what we're looking for, so return error
+	to user: */
+	if (finalN == 0)
 	{
 		std::cout << "Error: no valid phi(n) permutation with minimized n/phi(n) was found.\n";
 	}
 	else
 	{
-		/* Otherwise, report the n, phi(n), and 
+		/* Otherwise, report the n, phi(n), and
 		n/phi(n) back to user: */
-		std::cout << "n = " << finalN << " was foud to have phi(n) = "
+		std::cout << "n = " << finalN << " was found to have phi(n) = "
 			<< finaltotientN << " which is a permutation of n that yields the "
-			<< "minimized n/phi(n) = " << finalnphin << " for the range 1 < n < 10^7.\n";
+			<< "minimized n/phi(n) = " << static_cast<long double>(finalN) / finaltotientN
+			<< " for the range 1 < n < " << maxN << ".\n";
 	}
 
 
 	return 0;
-}
\ No newline at end of file
+}
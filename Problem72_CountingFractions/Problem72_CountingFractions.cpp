@@ -100,15 +100,54 @@ this counter can go to were we to go much higher.  Boost, however,
 will likely NOT help the other issue as the integer size requirement
 increases for the high end of the range of the vector; therefore,
 this is not a solution to the issue of vector::max_size().
+
+EDIT: phi(d) now comes from the shared ArithmeticSieve
+(see the SharedLibrary), a linear sieve which reaches every
+composite d exactly once, through its smallest prime factor
+p (d = i * p), and sets
+	phi(d) = phi(i) * p         if p also divides i,
+	phi(d) = phi(i) * (p - 1)   otherwise.
+This replaces the repeated division above (one per prime
+factor of every d) with a single multiplication per d, and
+the table is stored as uint32_t (4 bytes per d, whatever
+the platform makes of int_fast32_t), with only the phi
+table asked for.  The counter itself is safe in an
+int_fast64_t: the sum of phi(d) for d <= 10^9 is only about
+3 * 10^17 (roughly 3 d^2 / pi^2), so the real limit here is
+the memory for the table.
+
+EDIT: Even at 4 bytes per d, a table of every phi(d) stops
+fitting in memory somewhere around d <= 10^10, so the count
+is now found without one (see SharedLibrary/TotientSum.cpp).
+Every fraction a/b with 1 <= a, b <= n (there are n^2 of
+them, or n(n + 1)/2 with a <= b) reduces to exactly one
+fraction with denominator b/g <= n/g, where g = gcd(a,b).
+Writing Phi(n) for phi(1) + ... + phi(n), this gives
+	n(n + 1)/2 = Sigma_(g = 1)^(n) Phi(n/g)
+(with n/g rounded down), i.e.
+	Phi(n) = n(n + 1)/2 - Sigma_(g = 2)^(n) Phi(n/g).
+Since n/g only takes about 2 sqrt(n) distinct values, the
+sum is taken over runs of equal n/g, and every Phi it needs
+is again at some n/k, so those are remembered in an array
+indexed by k.  Below about n^(2/3) the Phi values are
+simply prefix sums of the ArithmeticSieve phi table.  In
+all, this is O(n^(2/3)) time and memory: d <= 10^11 takes
+a couple of seconds and a sieve of only about 2 * 10^7.
+
+The count for d <= 10^11 is about 3 * 10^21, past the range
+of any 64-bit integer, so it is returned as a (portable)
+128-bit UInt128.  The answer is Phi(maxd) - 1, since 1/1
+(phi(1)) is not a proper fraction.
 */
 
 #include <cstdint>
 #include <iostream>
-#include <numeric>  // for std::iota, used to make range of d.
-#include <vector>
+
+#include "../SharedLibrary/TotientSum.h"
+#include "../SharedLibrary/UInt128.h"
 
 
-using lint_t = int_fast32_t;
+using lint_t = int_fast64_t;
 
 
 int main()
@@ -119,55 +158,17 @@ int main()
 	lint_t maxdLimit{};
 	std::cin >> maxdLimit;
 
-
-	/* Initialize a counter for reduced proper fractions and
-	an array containing all numbers in the range: */
-	std::vector<lint_t> phiRange{};
-	phiRange.resize(maxdLimit + 1);
-
-	int_fast64_t counterRedPropFrac{ 0 }; // Must be larger than fast32!
-
-
-	/* Fill the d range vector with integers from 0 to
-	maxdLimit + 1, corresponds to their positions in
-	the vector (i.e. phiRange.at(2) = 2): */
-	std::iota(phiRange.begin(), phiRange.end(), 0);
-	
-
-	/* DEBUG: print phiRange to check it's values: */
-	/*std::cout << "( ";
-	for (lint_t a : phiRange)
+	if (maxdLimit < 1)
 	{
-		std::cout << a << " ";
+		std::cerr << "The upper limit for d must be at least 1.\n";
+		return 1;
 	}
-	std::cout << ")\n"; */
 
 
-	/* For loop for relevant d values; note that
-	phiRange.at(2) == 2 initially in the if statement
-	and that phiRange becomes the phi(d) function
-	through the if statement sieving before we add
-	any phiRange elements to the final sum: */
-	for (lint_t d{2}; d <= maxdLimit; ++d)
-	{
-		/* Note this, in combination with the inner for loop,
-		ensures that we only enact the sieving for prime factors: */
-		if (phiRange.at(d) == d)
-		{
-			/* Note this loop only hits multiples of a given d: */
-			for (lint_t j{ d }; j <= maxdLimit; j += d)
-			{
-				/* This sieves out non-prime factors of d by changing
-				the value of those elements to the phi(d) function
-				value (see equation in description of problem): */
-				phiRange.at(j) = (phiRange.at(j) / d) * (d - 1);
-			}
-		}
-		
-		/* Here is where we count the prime factors using the sum
-		of totient functions (again see equations above in description): */
-		counterRedPropFrac += phiRange.at(d);
-	}
+	/* Count the reduced proper fractions using the sum of
+	totient functions (again see equations above in
+	description), leaving out phi(1) for 1/1: */
+	const UInt128 counterRedPropFrac{ sumTotients(static_cast<uint64_t>(maxdLimit)) - 1 };
 
 
 	/* Now return the counter to the user as the
@@ -177,4 +178,4 @@ int main()
 		<< ".\n";
 
 	return 0;
-}
\ No newline at end of file
+}
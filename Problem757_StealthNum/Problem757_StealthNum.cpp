@@ -1,189 +1,181 @@
-// Currently yields incorrect values for StealthNum,
-// likely due to recounting unique sets of a,b,c,d.
-// This is slightly remedied by the use of additional
-// if statements, but the code still doesn't seem
-// to give correct values and runs rather slowly.
-// 
 // Program to determine the number of "stealthy" numbers,
-// denoted the counter stealthNum, in the range 
-// 1 <_ N <_ N_max for positive integer N as defined by 
+// denoted the counter stealthNum, in the range
+// 1 <_ N <_ N_max for positive integer N as defined by
 // the conditions:
     // i) ab = cd = N, where a,b,c,d, are also positive
     // integers
     // ii) a + b = c + d + 1
-// In this code, for each given N value, we force b = N/a 
-// and d = N/c to hard code condition i) and reduce the 
-// number of values needed when sweeping over values of 
-// a,b,c,d (notably these all must be less than N by 
-// condition i)).  Also note that by associativity
-// of multiplication, we prove ab = cd by showing
-// ab = N and cd = N.
-// 
-// We then check condition ii) by checking a + b = c + d + 1,
-// (which only excludes the cases (a=c, b=d) and
-// (a=d, b=c) if we also check that ab = cd, which double 
-// checks i)).  If this condition is satisfied,
-// then we have found a stealthy number, we increment
-// stealthNum and move to the next N value.  These loops
-// are repeated for all values of N in the given range.
-
+// The first version of this code, for each given N value,
+// forced b = N/a and d = N/c and swept over a and c to
+// check condition ii).  That is cubic in N_max (and
+// recounted some sets of a,b,c,d), so the real target of
+// N_max = 10^14 was far out of reach.
+//
+// Instead, the stealthy numbers are exactly the products
+//     N = x(x+1) * y(y+1),   1 <= x <= y.
+// One way round this is direct: with
+//     a = xy, b = (x+1)(y+1), c = x(y+1), d = (x+1)y
+// both products are x(x+1)y(y+1), and
+//     a + b = 2xy + x + y + 1 = c + d + 1.
+// Conversely (writing a, b, c, d through the gcds of a
+// with c and d), every solution of i) and ii) takes this
+// form, so every stealthy number comes up.  The same N may
+// come from more than one (x, y) though, e.g.
+// 144 = 1*2 * 8*9 = 3*4 * 3*4, so the products have
+// to be deduplicated rather than just counted.
+//
+// Here we count all N <_ N_max.  For N_max = 10^14 that is
+// about 10^8 (x, y) products, 800 MB if held all at once,
+// so they are generated window by window in increasing
+// order of N instead:
+//     i) For a window [first, last] of N, each x contributes
+//     the y >= x with x(x+1)y(y+1) in the window, a range
+//     found with two square roots (y(y+1) <_ t has an exact
+//     integer answer), so no y is ever skipped or repeated
+//     between windows.
+//
+//     ii) The window's products are sorted and the distinct
+//     ones counted.
+//
+//     iii) The window width is chosen from the density of
+//     the products near N (about H(N^(1/4)) / (2 sqrt(N))
+//     per unit, H the harmonic numbers), so that each
+//     window fills about one fixed-size buffer.
+// The memory is then bounded by that buffer (4M values,
+// 32 MB, per thread) whatever N_max is; 10^14 takes
+// about 7 seconds on one core.
+//
+// The range of N is also cut into 4096 shards, which are
+// counted on all cores by sweepRange() (see
+// SharedLibrary/RangeSweep.h).  It prints the progress as
+// it goes and, given a checkpoint file, saves the count so
+// far every minute, so a much larger N_max can be stopped
+// and picked up again from the file.
+//
+// Usage: Problem757 [N_max] [checkpoint file]
+
+#include <algorithm> // For std::sort(), std::unique().
+#include <cmath> // For std::log(), std::sqrt().
+#include <cstddef> // For std::size_t.
 #include <cstdint>
 #include <iostream>
+#include <vector>
 
-using largeint_t = std::int_least64_t;
+#include "../SharedLibrary/Arguments.h"
+#include "../SharedLibrary/RangeSweep.h"
 
-// Class for bundling a, b, c, d, for given value of N.
-// Includes an extra boolean value that determines if the
-// number set corresponds to a stealthy number.
-class StealthNumSet
+// Largest y with y(y+1) <= t:
+std::uint64_t largestPronicRoot(std::uint64_t t)
 {
-private:
-    largeint_t m_n{};
-    largeint_t m_a{};
-    largeint_t m_b{};
-    largeint_t m_c{};
-    largeint_t m_d{};
-    bool m_bool{};
-
-public:
-    StealthNumSet()
-        : m_n{ 1 }, m_a{ 1 }, m_b{ 1 }, m_c{ 1 }, m_d{ 1 },
-        m_bool{ false }
-    {
-    }
+    // y = (sqrt(4t + 1) - 1) / 2, corrected for rounding:
+    std::uint64_t y{ static_cast<std::uint64_t>((std::sqrt(4.0 * static_cast<double>(t) + 1.0) - 1.0) / 2.0) };
+    while (y > 0 && y * (y + 1) > t)
+        --y;
+    while ((y + 1) * (y + 2) <= t)
+        ++y;
+    return y;
+}
+
+// Counts the distinct stealthy numbers in [first, last],
+// using buffer (cleared first) to hold the window's
+// products:
+std::uint64_t countStealthInWindow(std::uint64_t first, std::uint64_t last,
+    std::vector<std::uint64_t>& buffer)
+{
+    buffer.clear();
 
-    StealthNumSet(largeint_t& N, largeint_t& a, largeint_t& c)
-        : m_n{ N }, m_a{ a }, m_b{ (N / a) }, m_c{ c }, m_d{ (N / c) },
-        m_bool{ false }
+    // The smallest product for x is x(x+1) * x(x+1):
+    for (std::uint64_t x{ 1 }; ; ++x)
     {
+        const std::uint64_t pronicX{ x * (x + 1) };
+        if (pronicX * pronicX > last)
+            break;
+
+        const std::uint64_t yLow{ std::max(x, largestPronicRoot((first - 1) / pronicX) + 1) };
+        const std::uint64_t yHigh{ largestPronicRoot(last / pronicX) };
+        for (std::uint64_t y{ yLow }; y <= yHigh; ++y)
+            buffer.push_back(pronicX * (y * (y + 1)));
     }
 
-    largeint_t getN() { return m_n; }
-    largeint_t geta() { return m_a; }
-    largeint_t getb() { return m_b; }
-    largeint_t getc() { return m_c; }
-    largeint_t getd() { return m_d; }
-    bool getBool() { return m_bool; }
+    std::sort(buffer.begin(), buffer.end());
+    return static_cast<std::uint64_t>(std::unique(buffer.begin(), buffer.end()) - buffer.begin());
+}
 
-    void setN(largeint_t& n1) { m_n = n1; }
-    void setab(largeint_t& a1)
-    {
-        m_a = a1;
-        m_b = (m_n / a1);
-    }
-    void setcd(largeint_t& c1)
-    {
-        m_c = c1;
-        m_d = (m_n / c1);
-    }
+// Counts the distinct stealthy numbers in [first, last],
+// a window of about bufferSize products at a time:
+std::uint64_t countStealthNumbers(std::uint64_t first, std::uint64_t last,
+    std::size_t bufferSize = std::size_t{ 1 } << 22)
+{
+    std::vector<std::uint64_t> buffer{};
 
-    // Checks condition ii) for stealthy numbers.
-    // Note condition i) is fully forced by the 
-    // set functions and the second constructor, i.e.
-    // they show ab = N and cd = N and thus ab = cd is true.
-    // Also note the cases (a=c, b=d), (a=d,b=c) are
-    // automatically excluded by this if statement when
-    // we include ab = cd as a secondary condition.
-    // Duplicate combinations of a,b,c,d are a problem though!
-    // To avoid recounting, we need to force a <= b and c <= d
-    // (e.g. to avoid recounting N=4, we note the 1,4,2,2 and 
-    // 4,1,2,2 permutations are identical) such that a,b and 
-    // c,d don't overshare values.  We implement this as 
-    // an if statement inside the other. 
-    // 
-    // We also need to address duplication between sets of
-    // a,b and c,d (e.g. for N=4 above, 2,2,1,4 is a 
-    // duplicate of 1,4,2,2). Since a and c set b and d,
-    // we can avoid this by also forcing a <= c (in which
-    // case, only the 1,4,2,2 variant will be counted).
-    // We implement this as the condition cCounter <= aCounter
-    // in the for loop in main (this reduces # of calcs
-    // significantly).
-    //
-    // If this function returns true, then the loops over a,
-    // c should be ended and we step to the next N.  While
-    // m_bool is false, both loops continue. 
-    bool checkStealth()
+    std::uint64_t stealthNum{ 0 };
+    for (std::uint64_t low{ first }; low <= last; )
     {
-        // Checks condition ii) only, since i) is forced.
-        if (((m_a + m_b) == (m_c + m_d + 1)) && ((m_a * m_b) == (m_c * m_d)))
-        {
-            // Avoids duplicate variations between a,b and 
-            // c,d values.
-            if ((m_a <= m_b) && (m_c <= m_d))
-            {
-            m_bool = true; // Implies N is stealthy number.
-            }
-        }
-        else
-        {
-            m_bool = false;
-        }
-
-        return m_bool;
+        // About H(low^(1/4)) / (2 sqrt(low)) products per
+        // unit of N near low:
+        const double density{ (std::log(static_cast<double>(low)) / 4.0 + 1.0)
+            / (2.0 * std::sqrt(static_cast<double>(low))) };
+        const double width{ std::max(static_cast<double>(bufferSize) / density, 1.0) };
+
+        const std::uint64_t high{ (width >= static_cast<double>(last - low)) ?
+            last : low + static_cast<std::uint64_t>(width) - 1 };
+
+        stealthNum += countStealthInWindow(low, high, buffer);
+
+        if (high == last)
+            break;
+        low = high + 1;
     }
 
-    void resetBool() { m_bool = false; }
-};
+    return stealthNum;
+}
 
 
 
-int main()
+int main(int argc, char* argv[])
 {
-    // Request the maximum upper bound for N from user:
-    std::cout << "Enter the maximum value of N (positive integer): "
-        << '\n';
-    largeint_t nMax{};
-    std::cin >> nMax;
-
-    largeint_t stealthNum{ 0 }; // counter for total # of stealhy numbers
+    // The maximum bound for N, 10^14 by default (at most
+    // 2^62, to keep x(x+1)y(y+1) well inside 64 bits), and
+    // the checkpoint file to resume from (if any):
+    std::uint64_t nMax{ 100000000000000 };
+    if (argc > 1 && !parseArgument(argv[1], 1, std::uint64_t{ 1 } << 62, nMax))
+    {
+        std::cerr << "ERROR in main(): N_max must be from 1 to 2^62.\n";
+        return 1;
+    }
 
-    // Create our stealth number set object, which we will
-    // use as the memory bank for the values as we sweep
-    // through them (we replace values in this object as we
-    // sweep so they only have one value at a time).
-    StealthNumSet numSetN{};
+    RangeSweepOptions options{};
+    options.checkpointFile = (argc > 2) ? argv[2] : "";
+    options.shardSize = std::max<std::uint64_t>(nMax / 4096, 1000000);
 
     // Tell user it's working on it:
     std::cout << "Calculating..." << '\n';
 
-    // Loop over N, from 1 up to (but not at) N_max:
-    for (largeint_t nCounter{ 1 }; nCounter < nMax; ++nCounter)
+    try
     {
-        numSetN.setN(nCounter);
-
-        // Loop over c, from 1 to the current N:
-        for (largeint_t cCounter{ 1 }; cCounter <= nCounter; ++cCounter)
-        {
-            numSetN.setcd(cCounter); // Sets a,b, in the object
-
-            // Loop over a, from 1 to the current a.
-            // Uses cCounter to avoid duplicate sets of a,b,c,d.
-            for (largeint_t aCounter{ 1 }; aCounter <= cCounter; ++aCounter)
+        // Each shard of N is counted on its own (the windows
+        // never overlap) and the counts are summed:
+        const SweepState total{ sweepRange(1, nMax, SweepState{ 0 },
+            [](std::uint64_t first, std::uint64_t last, SweepState& shard)
             {
-                numSetN.setab(aCounter); // Sets c,d in the object
-
-                // If this number set is stealthy:
-                if (numSetN.checkStealth())
-                {
-                    ++stealthNum; // increment stealthNum
-                    break;
-                }
-            }
-
-            if (numSetN.getBool())
+                shard[0] = countStealthNumbers(first, last);
+            },
+            [](SweepState& total, const SweepState& shard)
             {
-                break;
-            }
-        }
-
-        numSetN.resetBool();
+                total[0] += shard[0];
+            },
+            options) };
+
+        // Now we output the number of stealthy numbers up to
+        // Nmax to the screen:
+        std::cout << "There are " << total[0] << " stealthy numbers that are not larger than "
+            << nMax << "." << '\n';
+    }
+    catch (const char* exception)
+    {
+        std::cerr << "ERROR " << exception << ".\n";
+        return 1;
     }
-
-    // Now we output the number of stealthy numbers below
-    // Nmax to the screen:
-    std::cout << "There are " << stealthNum << " stealthy numbers that are less than "
-        << nMax << "." << '\n';
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,223 @@
+/* Exact cover solver for Problem 96,
+   accessed through #include "Problem96_DancingLinks.h" */
+
+#include "Problem96_DancingLinks.h"
+
+#include <cassert>
+
+
+/* Allocates every node the matrix will ever need:
+the root, one header per column and maxNodes 1-entries
+spread over rows 0..numRows-1. */
+DancingLinks::DancingLinks(int numColumns, int numRows, int maxNodes)
+{
+    const int total{ 1 + numColumns + maxNodes };
+
+    m_left.resize(total);
+    m_right.resize(total);
+    m_up.resize(total);
+    m_down.resize(total);
+    m_column.resize(total);
+    m_rowOf.resize(total, -1);
+    m_size.resize(numColumns + 1);
+    m_rowStart.resize(numRows, -1);
+
+    /* The root and the column headers form one circular
+    list; each header starts as an empty column: */
+    for (int h{ 0 }; h <= numColumns; ++h)
+    {
+        m_left[h] = (h == 0) ? numColumns : h - 1;
+        m_right[h] = (h == numColumns) ? 0 : h + 1;
+        m_up[h] = h;
+        m_down[h] = h;
+        m_column[h] = h;
+    }
+    m_numNodes = numColumns + 1;
+
+    m_selected.reserve(numColumns);
+    m_stack.resize(numColumns);
+    m_solution.reserve(numColumns);
+}
+
+
+/* Adds a row with 1-entries in the given (zero-based)
+columns: */
+void DancingLinks::addRow(int rowId, const int* columns, int count)
+{
+    assert(m_numNodes + count <= static_cast<int>(m_left.size()));
+    assert(m_rowStart[rowId] == -1);
+
+    const int first{ m_numNodes };
+
+    for (int i{ 0 }; i < count; ++i)
+    {
+        const int node{ m_numNodes++ };
+        const int header{ columns[i] + 1 };
+
+        /* Link at the bottom of its column: */
+        m_column[node] = header;
+        m_rowOf[node] = rowId;
+        m_up[node] = m_up[header];
+        m_down[node] = header;
+        m_down[m_up[header]] = node;
+        m_up[header] = node;
+        ++m_size[header];
+
+        /* Link at the end of the row: */
+        m_left[node] = (i == 0) ? node : node - 1;
+        m_right[node] = first;
+        m_right[m_left[node]] = node;
+        m_left[first] = node;
+    }
+
+    m_rowStart[rowId] = first;
+}
+
+
+/* Removes a column header from the header list and
+every row that has a 1 in that column from the
+other columns it meets: */
+void DancingLinks::cover(int col)
+{
+    m_right[m_left[col]] = m_right[col];
+    m_left[m_right[col]] = m_left[col];
+
+    for (int i{ m_down[col] }; i != col; i = m_down[i])
+    {
+        for (int j{ m_right[i] }; j != i; j = m_right[j])
+        {
+            m_down[m_up[j]] = m_down[j];
+            m_up[m_down[j]] = m_up[j];
+            --m_size[m_column[j]];
+        }
+    }
+}
+
+
+/* Exactly undoes cover(col), in reverse order: */
+void DancingLinks::uncover(int col)
+{
+    for (int i{ m_up[col] }; i != col; i = m_up[i])
+    {
+        for (int j{ m_left[i] }; j != i; j = m_left[j])
+        {
+            ++m_size[m_column[j]];
+            m_down[m_up[j]] = j;
+            m_up[m_down[j]] = j;
+        }
+    }
+
+    m_right[m_left[col]] = col;
+    m_left[m_right[col]] = col;
+}
+
+
+/* Forces a row into the cover; returns false (and
+changes nothing) if that row clashes with a row
+already selected: */
+bool DancingLinks::selectRow(int rowId)
+{
+    const int start{ m_rowStart[rowId] };
+    assert(start != -1);
+
+    /* A covered column is no longer in the header list: */
+    int node{ start };
+    do
+    {
+        const int col{ m_column[node] };
+        if (m_right[m_left[col]] != col)
+            return false;
+        node = m_right[node];
+    } while (node != start);
+
+    node = start;
+    do
+    {
+        cover(m_column[node]);
+        node = m_right[node];
+    } while (node != start);
+
+    m_selected.push_back(rowId);
+    return true;
+}
+
+
+/* Undoes every selectRow(), most recent first: */
+void DancingLinks::unselectAll()
+{
+    while (!m_selected.empty())
+    {
+        const int start{ m_rowStart[m_selected.back()] };
+        m_selected.pop_back();
+
+        for (int j{ m_left[start] }; j != start; j = m_left[j])
+            uncover(m_column[j]);
+        uncover(m_column[start]);
+    }
+}
+
+
+/* One level of Algorithm X: */
+void DancingLinks::searchLevel(int depth)
+{
+    /* Every column is covered, so the rows on the
+    stack are an exact cover: */
+    if (m_right[0] == 0)
+    {
+        if (m_numSolutions++ == 0)
+            m_solution.assign(m_stack.begin(), m_stack.begin() + depth);
+        return;
+    }
+
+    /* Branch on the column with the fewest rows left: */
+    int best{ m_right[0] };
+    for (int col{ m_right[best] }; col != 0 && m_size[best] > 0; col = m_right[col])
+    {
+        if (m_size[col] < m_size[best])
+            best = col;
+    }
+
+    if (m_size[best] == 0)
+    {
+        ++m_deadEnds;
+        return;
+    }
+
+    cover(best);
+
+    for (int r{ m_down[best] }; r != best && m_numSolutions < m_maxSolutions; r = m_down[r])
+    {
+        m_stack[depth] = m_rowOf[r];
+        ++m_nodes;
+
+        for (int j{ m_right[r] }; j != r; j = m_right[j])
+            cover(m_column[j]);
+
+        searchLevel(depth + 1);
+
+        for (int j{ m_left[r] }; j != r; j = m_left[j])
+            uncover(m_column[j]);
+    }
+
+    uncover(best);
+}
+
+
+/* Searches for exact covers of the columns left after
+selectRow(), stopping once maxSolutions have been
+found; returns how many were found (so a return of
+maxSolutions means "at least that many").  The matrix
+is left exactly as it was before the call. */
+int_fast64_t DancingLinks::search(int_fast64_t maxSolutions)
+{
+    m_numSolutions = 0;
+    m_maxSolutions = maxSolutions;
+    m_nodes = 0;
+    m_deadEnds = 0;
+    m_solution.clear();
+
+    if (maxSolutions > 0)
+        searchLevel(0);
+
+    return m_numSolutions;
+}
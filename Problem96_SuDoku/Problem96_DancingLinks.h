@@ -0,0 +1,75 @@
+/* Exact cover solver for Problem 96,
+   accessed through #include "Problem96_DancingLinks.h" */
+
+#ifndef PROBLEM96_DANCINGLINKS_H
+#define PROBLEM96_DANCINGLINKS_H
+
+#include <cstdint> // For large integer (non-digit) types.
+#include <vector>
+
+
+/* Knuth's Algorithm X with "dancing links": the exact cover
+matrix is held as circular doubly linked lists of its
+1-entries (nodes), one list across each row and one down
+each column, all in arrays allocated once by the
+constructor.  Covering a column unlinks it and every row
+that meets it; uncovering relinks them in reverse order,
+which is what makes backtracking cheap.
+
+Rows are added once with addRow().  selectRow() then
+forces a row into the cover up front (e.g. a Su Doku
+given) and unselectAll() undoes those, so the same matrix
+can be reused for many problems of the same shape without
+rebuilding or allocating. */
+class DancingLinks
+{
+private:
+    /* Node 0 is the root; nodes 1..numColumns are
+    the column headers; rows follow. */
+    std::vector<int> m_left{};
+    std::vector<int> m_right{};
+    std::vector<int> m_up{};
+    std::vector<int> m_down{};
+    std::vector<int> m_column{};
+    std::vector<int> m_rowOf{};
+    std::vector<int> m_size{};
+
+    /* First node of each row id, or -1: */
+    std::vector<int> m_rowStart{};
+
+    int m_numNodes{};
+
+    /* Rows forced by selectRow(), rows picked by the
+    current search, and the first solution found: */
+    std::vector<int> m_selected{};
+    std::vector<int> m_stack{};
+    std::vector<int> m_solution{};
+
+    int_fast64_t m_numSolutions{};
+    int_fast64_t m_maxSolutions{};
+    int_fast64_t m_nodes{};
+    int_fast64_t m_deadEnds{};
+
+    void cover(int col);
+    void uncover(int col);
+    void searchLevel(int depth);
+
+public:
+    DancingLinks(int numColumns, int numRows, int maxNodes);
+
+    void addRow(int rowId, const int* columns, int count);
+
+    bool selectRow(int rowId);
+    void unselectAll();
+
+    int_fast64_t search(int_fast64_t maxSolutions);
+
+    /* Row ids of the first solution found by search(),
+    not including the rows from selectRow(): */
+    const std::vector<int>& getSolution() const { return m_solution; }
+
+    int_fast64_t getNodes() const { return m_nodes; }
+    int_fast64_t getDeadEnds() const { return m_deadEnds; }
+};
+
+#endif
@@ -0,0 +1,272 @@
+/* Function Library for Problem 96,
+   accessed through #include "Problem96_FunctionLibrary.h" */
+
+#include "Problem96_FunctionLibrary.h"
+
+#include <algorithm> // For std::max().
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory> // For std::unique_ptr.
+#include <mutex>
+#include <thread>
+#include <utility> // For std::move().
+#include <vector>
+
+
+/* Reads lines until one is not blank; returns false at
+the end of the stream: */
+bool SuDokuReader::nextNonBlankLine()
+{
+    while (std::getline(m_in, m_line))
+    {
+        ++m_lineNumber;
+        if (m_line.find_first_not_of(" \t\r") != std::string::npos)
+            return true;
+    }
+    return false;
+}
+
+
+/* Reads the next puzzle into grid; returns false once
+the stream holds no more puzzles.  Throws on a
+malformed puzzle. */
+bool SuDokuReader::readNext(SuDokuGrid& grid)
+{
+    if (!nextNonBlankLine())
+        return false;
+
+    /* "Grid NN" header, then nine rows of nine digits: */
+    if (m_line.compare(0, 4, "Grid") == 0)
+    {
+        for (int row{ 0 }; row < 9; ++row)
+        {
+            if (!nextNonBlankLine())
+                throw "in SuDokuReader::readNext(): file ended inside a grid";
+
+            int col{ 0 };
+            for (char c : m_line)
+            {
+                if (col == 9)
+                    break;
+                if (c >= '0' && c <= '9')
+                    grid[row * 9 + col++] = static_cast<int_fast8_t>(c - '0');
+                else if (c == '.')
+                    grid[row * 9 + col++] = 0;
+            }
+
+            if (col != 9)
+                throw "in SuDokuReader::readNext(): grid row with fewer than nine cells";
+        }
+        return true;
+    }
+
+    /* One puzzle per line: */
+    int cell{ 0 };
+    for (char c : m_line)
+    {
+        if (cell == 81)
+            break;
+        if (c >= '0' && c <= '9')
+            grid[cell++] = static_cast<int_fast8_t>(c - '0');
+        else if (c == '.')
+            grid[cell++] = 0;
+        else
+            break;
+    }
+
+    if (cell != 81)
+        throw "in SuDokuReader::readNext(): puzzle line with fewer than 81 cells";
+
+    return true;
+}
+
+
+namespace
+{
+    /* A run of consecutive puzzles from the stream, solved
+    together by one worker thread: */
+    struct PuzzleChunk
+    {
+        int_fast64_t sequence{};
+        int_fast64_t firstIndex{};
+        std::vector<SuDokuGrid> grids{};
+        std::vector<lint_t> first3dig{}; // -1 if the puzzle had no solution.
+        int_fast64_t numMultiple{};
+        int_fast64_t nodes{};
+        int_fast64_t backtracks{};
+    };
+
+    constexpr std::size_t chunkSize{ 1024 };
+}
+
+
+/* Solves every puzzle in the stream on a pool of worker
+threads (numThreads = 0 uses one per core) and returns
+the totals.  The main thread reads puzzles in chunks and
+hands them to the workers, each of which reuses a single
+SuDukoNxN object, so solving allocates nothing per puzzle.
+Finished chunks are reduced strictly in input order, and
+onResult (if given) is called from this thread with each
+puzzle's index and getFirst3digNum() (or -1 if the puzzle
+has no solution), also in input order.  With
+maxSolutions of 2 or more, each puzzle's solutions are
+counted up to that cap and puzzles with more than one
+are tallied in numMultiple.  At most two
+chunks per thread are in flight, so memory stays bounded
+however many puzzles the stream holds. */
+SuDokuBatchResult solveSuDokuStream(std::istream& in, unsigned numThreads,
+    const std::function<void(int_fast64_t, lint_t)>& onResult,
+    int_fast64_t maxSolutions)
+{
+    if (numThreads == 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    if (maxSolutions < 1)
+        maxSolutions = 1;
+
+    std::mutex mtx;
+    std::condition_variable workReady;
+    std::condition_variable workDone;
+    std::deque<std::unique_ptr<PuzzleChunk>> pending{};
+    std::map<int_fast64_t, std::unique_ptr<PuzzleChunk>> finished{};
+    bool noMoreWork{ false };
+
+
+    auto worker = [&]()
+    {
+        SuDukoNxN solver{};
+
+        while (true)
+        {
+            std::unique_ptr<PuzzleChunk> chunk{};
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                workReady.wait(lock, [&]() { return !pending.empty() || noMoreWork; });
+                if (pending.empty())
+                    return;
+                chunk = std::move(pending.front());
+                pending.pop_front();
+            }
+
+            chunk->first3dig.resize(chunk->grids.size());
+            for (std::size_t i{ 0 }; i < chunk->grids.size(); ++i)
+            {
+                solver.loadMatrix(9, chunk->grids[i].data());
+                const int_fast64_t found{ solver.countSolutions(maxSolutions) };
+                chunk->first3dig[i] = (found > 0) ? solver.getFirst3digNum() : -1;
+                if (found > 1)
+                    ++chunk->numMultiple;
+                chunk->nodes += solver.getStats().nodes;
+                chunk->backtracks += solver.getStats().backtracks;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                finished[chunk->sequence] = std::move(chunk);
+            }
+            workDone.notify_one();
+        }
+    };
+
+    std::vector<std::thread> pool{};
+    for (unsigned t{ 0 }; t < numThreads; ++t)
+        pool.emplace_back(worker);
+
+
+    SuDokuBatchResult result{};
+    int_fast64_t nextToReduce{ 0 };
+    int_fast64_t inFlight{ 0 };
+
+    auto reduceChunk = [&](const PuzzleChunk& chunk)
+    {
+        for (std::size_t i{ 0 }; i < chunk.first3dig.size(); ++i)
+        {
+            ++result.numPuzzles;
+            if (chunk.first3dig[i] >= 0)
+            {
+                ++result.numSolved;
+                result.first3digSum += chunk.first3dig[i];
+            }
+            if (onResult)
+                onResult(chunk.firstIndex + static_cast<int_fast64_t>(i), chunk.first3dig[i]);
+        }
+        result.numMultiple += chunk.numMultiple;
+        result.nodes += chunk.nodes;
+        result.backtracks += chunk.backtracks;
+    };
+
+    /* Reduces finished chunks, in order, until no more
+    than maxInFlight chunks remain outstanding: */
+    auto reduceUntil = [&](int_fast64_t maxInFlight)
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        while (inFlight > maxInFlight)
+        {
+            workDone.wait(lock, [&]() { return finished.count(nextToReduce) != 0; });
+            std::unique_ptr<PuzzleChunk> chunk{ std::move(finished[nextToReduce]) };
+            finished.erase(nextToReduce);
+            ++nextToReduce;
+            --inFlight;
+
+            lock.unlock();
+            reduceChunk(*chunk);
+            lock.lock();
+        }
+    };
+
+    auto stopPool = [&]()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            noMoreWork = true;
+        }
+        workReady.notify_all();
+        for (std::thread& t : pool)
+            t.join();
+    };
+
+
+    try
+    {
+        SuDokuReader reader(in);
+        int_fast64_t sequence{ 0 };
+        int_fast64_t index{ 0 };
+
+        while (true)
+        {
+            std::unique_ptr<PuzzleChunk> chunk{ new PuzzleChunk{} };
+            chunk->sequence = sequence;
+            chunk->firstIndex = index;
+            chunk->grids.reserve(chunkSize);
+
+            SuDokuGrid grid{};
+            while (chunk->grids.size() < chunkSize && reader.readNext(grid))
+                chunk->grids.push_back(grid);
+
+            if (chunk->grids.empty())
+                break;
+
+            index += static_cast<int_fast64_t>(chunk->grids.size());
+            ++sequence;
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                pending.push_back(std::move(chunk));
+                ++inFlight;
+            }
+            workReady.notify_one();
+
+            reduceUntil(2 * static_cast<int_fast64_t>(numThreads));
+        }
+
+        reduceUntil(0);
+    }
+    catch (...)
+    {
+        stopPool();
+        throw;
+    }
+
+    stopPool();
+
+    return result;
+}
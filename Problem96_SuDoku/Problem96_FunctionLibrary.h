@@ -0,0 +1,61 @@
+#ifndef PROBLEM96_FUNCTIONLIBRARY_H
+#define PROBLEM96_FUNCTIONLIBRARY_H
+
+#include <array>
+#include <cstdint> // For large integer (non-digit) types.
+#include <functional> // For std::function.
+#include <iostream>
+#include <string> // For std::string.
+
+#include "Problem96_SuDokuNxN.h"
+
+
+/* One 9x9 puzzle, row-major, zero for "empty" cells: */
+using SuDokuGrid = std::array<int_fast8_t, 81>;
+
+
+/* Streaming reader for 9x9 puzzle files.  Each call to
+readNext() returns the next puzzle in the stream, where
+puzzles may be in either format (mixed freely):
+    i) A "Grid NN" header line followed by nine lines
+    of nine digits, as in the p096_sudoku.txt file.
+    ii) One puzzle per line, the first 81 characters
+    of which are digits 0-9 or '.' (both '0' and '.'
+    are "empty" cells); anything after those is ignored.
+Blank lines are skipped.  Only one line is held in
+memory at a time, so files of any size can be read. */
+class SuDokuReader
+{
+private:
+    std::istream& m_in;
+    std::string m_line{};
+    int_fast64_t m_lineNumber{};
+
+    bool nextNonBlankLine();
+
+public:
+    explicit SuDokuReader(std::istream& in) : m_in{ in } {}
+
+    bool readNext(SuDokuGrid& grid);
+
+    int_fast64_t getLineNumber() const { return m_lineNumber; }
+};
+
+
+/* Totals over a batch of puzzles: */
+struct SuDokuBatchResult
+{
+    int_fast64_t numPuzzles{};
+    int_fast64_t numSolved{};
+    int_fast64_t numMultiple{}; // Solved puzzles found to have more than one solution.
+    int_fast64_t first3digSum{};
+    int_fast64_t nodes{};
+    int_fast64_t backtracks{};
+};
+
+
+SuDokuBatchResult solveSuDokuStream(std::istream& in, unsigned numThreads = 0,
+    const std::function<void(int_fast64_t, lint_t)>& onResult = nullptr,
+    int_fast64_t maxSolutions = 1);
+
+#endif
@@ -0,0 +1,845 @@
+/* Su Doku solver class for Problem 96,
+   accessed through #include "Problem96_SuDokuNxN.h".
+   See Problem96_SuDoku.cpp for a description of the method. */
+
+#ifndef PROBLEM96_SUDOKUNXN_H
+#define PROBLEM96_SUDOKUNXN_H
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <memory> // For std::unique_ptr.
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h> // For __popcnt16() and _BitScanForward().
+#endif
+
+#include "Problem96_DancingLinks.h"
+
+
+using lint_t = int_fast16_t;
+using mask_t = uint16_t;
+
+
+/* Largest grid the class can hold (25x25), and the
+largest grid the uint16_t masks can hold (16x16), which
+sizes all the fixed arrays of the bitmask solver: */
+constexpr int maxN{ 25 };
+constexpr int maxCells{ maxN * maxN };
+constexpr int maxMaskN{ 16 };
+constexpr int maxMaskCells{ maxMaskN * maxMaskN };
+constexpr int maxUnits{ 3 * maxMaskN };
+
+/* Each trail entry removes at least one candidate bit
+from one cell, so this bounds the trail on any path: */
+constexpr int maxTrail{ maxMaskCells * maxMaskN };
+
+
+/* Number of set bits in a mask (i.e. the number of
+candidates in a cell): */
+inline int countCandidates(mask_t mask)
+{
+#if defined(_MSC_VER)
+    return static_cast<int>(__popcnt16(mask));
+#else
+    return __builtin_popcount(mask);
+#endif
+}
+
+
+/* Index of the lowest set bit of a non-zero mask
+(i.e. the lowest candidate value minus one): */
+inline int lowestCandidate(mask_t mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index{};
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+
+/* Which search solveSuDukoNxN() runs; grids larger
+than 16x16 always use dancing links: */
+enum class SuDokuBackend
+{
+    bitmask,
+    dancingLinks,
+};
+
+
+/* Counters for benchmarking the search: */
+struct SolverStats
+{
+    int_fast64_t nodes{};      // Guesses made while branching.
+    int_fast64_t backtracks{}; // Guesses that led to a contradiction.
+    int maxDepth{};            // Deepest level of guessing reached.
+};
+
+
+/* Class for Su Doku matricies: */
+class SuDukoNxN
+{
+private:
+    /* One entry of the undo trail: */
+    struct TrailEntry
+    {
+        int16_t cell{};
+        mask_t oldCandidates{};
+        int_fast8_t oldValue{};
+    };
+
+    /* Flat grid of cell values, row-major; zero is "empty": */
+    std::array<int_fast8_t, maxCells> m_cells{};
+
+    /* Bit (v - 1) set means v is still possible in that cell: */
+    std::array<mask_t, maxMaskCells> m_candidates{};
+
+    /* Cell indices of each unit: rows first, then
+    columns, then boxes: */
+    std::array<std::array<int16_t, maxMaskN>, maxUnits> m_units{};
+
+    /* Undo trail and the queue of cells found to have
+    a single candidate but not yet assigned: */
+    std::array<TrailEntry, maxTrail> m_trail{};
+    int m_trailSize{};
+    std::array<int16_t, maxMaskCells> m_singles{};
+    int m_numSingles{};
+
+    /* Search state per depth of guessing: */
+    std::array<int16_t, maxMaskCells> m_branchCell{};
+    std::array<mask_t, maxMaskCells> m_branchCandidates{};
+    std::array<int, maxMaskCells> m_branchTrail{};
+
+    /* First solution found while counting: */
+    std::array<int_fast8_t, maxMaskCells> m_solution{};
+
+    /* Exact cover matrix for the dancing links backend,
+    built the first time it is needed for a given N: */
+    std::unique_ptr<DancingLinks> m_links{};
+    int m_linksN{};
+    SuDokuBackend m_backend{ SuDokuBackend::bitmask };
+
+    int m_n{};
+    int m_boxSize{};
+    int m_numEmpty{};
+    mask_t m_allValues{};
+
+    /* False if the given values already break the rules: */
+    bool m_consistent{ true };
+
+    SolverStats m_stats{};
+
+
+    int boxIndex(int row, int col) const
+    {
+        return (row / m_boxSize) * m_boxSize + (col / m_boxSize);
+    }
+
+    /* Fills m_units for the current N: */
+    void buildUnits()
+    {
+        for (int k{ 0 }; k < m_n; ++k)
+        {
+            for (int j{ 0 }; j < m_n; ++j)
+            {
+                const int16_t cell{ static_cast<int16_t>(k * m_n + j) };
+                const int box{ boxIndex(k, j) };
+                const int posInBox{ (k % m_boxSize) * m_boxSize + (j % m_boxSize) };
+
+                m_units[k][j] = cell;
+                m_units[m_n + j][k] = cell;
+                m_units[2 * m_n + box][posInBox] = cell;
+            }
+        }
+    }
+
+
+    /* Sets N, the box size and the unit tables: */
+    void setSize(int n)
+    {
+        assert(n > 0 && n <= maxN);
+
+        m_n = n;
+        m_boxSize = 0;
+        while ((m_boxSize + 1) * (m_boxSize + 1) <= n)
+            ++m_boxSize;
+        assert(m_boxSize * m_boxSize == n);
+
+        /* Only the bitmask solver needs these: */
+        if (n <= maxMaskN)
+        {
+            m_allValues = static_cast<mask_t>((1u << n) - 1u);
+            buildUnits();
+        }
+    }
+
+
+    bool usesDancingLinks() const
+    {
+        return m_backend == SuDokuBackend::dancingLinks || m_n > maxMaskN;
+    }
+
+
+    /* Exact cover row for value val in cell (row, col): */
+    int linksRow(int row, int col, int val) const
+    {
+        return (row * m_n + col) * m_n + (val - 1);
+    }
+
+    /* Builds the exact cover matrix for Su Doku of size N:
+    one row per (cell, value) and four columns per row,
+    for "cell is filled", "value is in this row", "value
+    is in this column" and "value is in this box": */
+    void buildLinks()
+    {
+        const int n{ m_n };
+        const int nn{ n * n };
+
+        m_links.reset(new DancingLinks(4 * nn, nn * n, 4 * nn * n));
+        m_linksN = n;
+
+        for (int row{ 0 }; row < n; ++row)
+        {
+            for (int col{ 0 }; col < n; ++col)
+            {
+                for (int val{ 1 }; val <= n; ++val)
+                {
+                    const int columns[4]{
+                        row * n + col,
+                        nn + row * n + (val - 1),
+                        2 * nn + col * n + (val - 1),
+                        3 * nn + boxIndex(row, col) * n + (val - 1) };
+
+                    m_links->addRow(linksRow(row, col, val), columns, 4);
+                }
+            }
+        }
+    }
+
+
+    /* Solves the matrix as an exact cover problem: the
+    givens are selected up front, and the search stops
+    once maxSolutions covers have been found.  The first
+    one fills in the "empty" cells.  The matrix is
+    restored afterwards so it can be reused. */
+    int_fast64_t searchByDancingLinks(int_fast64_t maxSolutions)
+    {
+        if (!m_consistent)
+            return 0;
+
+        if (!m_links || m_linksN != m_n)
+            buildLinks();
+
+        bool givensFit{ true };
+
+        for (int cell{ 0 }; cell < m_n * m_n && givensFit; ++cell)
+        {
+            if (m_cells[cell] != 0 && !m_links->selectRow(linksRow(cell / m_n, cell % m_n, m_cells[cell])))
+                givensFit = false;
+        }
+
+        const int_fast64_t found{ givensFit ? m_links->search(maxSolutions) : 0 };
+
+        if (found > 0)
+        {
+            for (int rowId : m_links->getSolution())
+            {
+                m_cells[rowId / m_n] = static_cast<int_fast8_t>(rowId % m_n + 1);
+            }
+        }
+
+        m_stats.nodes = m_links->getNodes();
+        m_stats.backtracks = m_links->getDeadEnds();
+        m_links->unselectAll();
+
+        return found;
+    }
+
+
+    /* Records the current state of a cell on the trail: */
+    void saveCell(int cell)
+    {
+        m_trail[m_trailSize++] = { static_cast<int16_t>(cell), m_candidates[cell], m_cells[cell] };
+    }
+
+    /* Pops the trail back down to the given size: */
+    void undoTrail(int trailSize)
+    {
+        while (m_trailSize > trailSize)
+        {
+            const TrailEntry& entry{ m_trail[--m_trailSize] };
+            if (m_cells[entry.cell] != 0 && entry.oldValue == 0)
+                ++m_numEmpty;
+            m_candidates[entry.cell] = entry.oldCandidates;
+            m_cells[entry.cell] = entry.oldValue;
+        }
+        m_numSingles = 0;
+    }
+
+
+    /* Removes the candidate bits from an "empty" cell;
+    returns false if that leaves the cell without
+    any candidates: */
+    bool eliminate(int cell, mask_t bits)
+    {
+        if (m_cells[cell] != 0 || (m_candidates[cell] & bits) == 0)
+            return true;
+
+        saveCell(cell);
+        m_candidates[cell] &= static_cast<mask_t>(~bits);
+
+        const int remaining{ countCandidates(m_candidates[cell]) };
+        if (remaining == 0)
+            return false;
+        if (remaining == 1)
+            m_singles[m_numSingles++] = static_cast<int16_t>(cell);
+
+        return true;
+    }
+
+
+    /* Assigns val to an "empty" cell and removes it
+    from every other cell in its row, column and box: */
+    bool assign(int cell, int val)
+    {
+        const mask_t bit{ static_cast<mask_t>(1u << (val - 1)) };
+
+        if (m_cells[cell] != 0)
+            return m_cells[cell] == val;
+        if ((m_candidates[cell] & bit) == 0)
+            return false;
+
+        saveCell(cell);
+        m_candidates[cell] = bit;
+        m_cells[cell] = static_cast<int_fast8_t>(val);
+        --m_numEmpty;
+
+        const int row{ cell / m_n };
+        const int col{ cell % m_n };
+        const int box{ boxIndex(row, col) };
+
+        for (int i{ 0 }; i < m_n; ++i)
+        {
+            const int peers[3]{ m_units[row][i], m_units[m_n + col][i], m_units[2 * m_n + box][i] };
+            for (int peer : peers)
+            {
+                if (peer == cell)
+                    continue;
+
+                /* A "filled" peer with the same value: */
+                if (m_cells[peer] == val)
+                    return false;
+
+                if (!eliminate(peer, bit))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+
+    /* Assigns every queued naked single: */
+    bool assignSingles()
+    {
+        while (m_numSingles > 0)
+        {
+            const int cell{ m_singles[--m_numSingles] };
+            if (m_cells[cell] == 0 && !assign(cell, lowestCandidate(m_candidates[cell]) + 1))
+                return false;
+        }
+        return true;
+    }
+
+
+    /* Hidden singles over all units; sets changed if
+    anything was assigned: */
+    bool findHiddenSingles(bool& changed)
+    {
+        for (int u{ 0 }; u < 3 * m_n; ++u)
+        {
+            mask_t once{ 0 };
+            mask_t twice{ 0 };
+            mask_t filled{ 0 };
+
+            for (int i{ 0 }; i < m_n; ++i)
+            {
+                const int cell{ m_units[u][i] };
+                const mask_t cand{ m_candidates[cell] };
+
+                if (m_cells[cell] != 0)
+                    filled |= cand;
+                twice |= static_cast<mask_t>(once & cand);
+                once |= cand;
+            }
+
+            /* Some value has nowhere to go in this unit: */
+            if (once != m_allValues)
+                return false;
+
+            mask_t hidden{ static_cast<mask_t>(once & ~twice & ~filled) };
+            while (hidden != 0)
+            {
+                const int bitIndex{ lowestCandidate(hidden) };
+                const mask_t bit{ static_cast<mask_t>(1u << bitIndex) };
+                hidden &= static_cast<mask_t>(hidden - 1);
+
+                for (int i{ 0 }; i < m_n; ++i)
+                {
+                    const int cell{ m_units[u][i] };
+                    if (m_candidates[cell] & bit)
+                    {
+                        /* An earlier assignment in this loop may
+                        have already removed the bit: */
+                        if (!assign(cell, bitIndex + 1))
+                            return false;
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+
+            if (!assignSingles())
+                return false;
+        }
+
+        return true;
+    }
+
+
+    /* Locked candidates (pointing and claiming) between
+    boxes and rows, then boxes and columns.  A "segment"
+    is the (up to) sqrt(N) cells where a row or column
+    crosses a box; segment[line][b] holds the OR of the
+    "empty" cells' candidates there. */
+    bool findLockedCandidates(bool& changed)
+    {
+        for (int byColumn{ 0 }; byColumn < 2; ++byColumn)
+        {
+            std::array<std::array<mask_t, maxMaskN>, maxMaskN> segment{};
+
+            for (int line{ 0 }; line < m_n; ++line)
+            {
+                for (int i{ 0 }; i < m_n; ++i)
+                {
+                    const int cell{ byColumn ? (i * m_n + line) : (line * m_n + i) };
+                    if (m_cells[cell] == 0)
+                        segment[line][i / m_boxSize] |= m_candidates[cell];
+                }
+            }
+
+            for (int line{ 0 }; line < m_n; ++line)
+            {
+                const int band{ line / m_boxSize };
+
+                for (int b{ 0 }; b < m_boxSize; ++b)
+                {
+                    mask_t otherBoxes{ 0 };
+                    for (int b2{ 0 }; b2 < m_boxSize; ++b2)
+                    {
+                        if (b2 != b)
+                            otherBoxes |= segment[line][b2];
+                    }
+
+                    mask_t otherLines{ 0 };
+                    for (int l2{ band * m_boxSize }; l2 < (band + 1) * m_boxSize; ++l2)
+                    {
+                        if (l2 != line)
+                            otherLines |= segment[l2][b];
+                    }
+
+                    /* Pointing: only this line of the box holds
+                    these values, so clear them from the line
+                    outside the box: */
+                    const mask_t pointing{ static_cast<mask_t>(segment[line][b] & ~otherLines & otherBoxes) };
+
+                    /* Claiming: only this box of the line holds
+                    these values, so clear them from the box
+                    outside the line: */
+                    const mask_t claiming{ static_cast<mask_t>(segment[line][b] & ~otherBoxes & otherLines) };
+
+                    if (pointing == 0 && claiming == 0)
+                        continue;
+
+                    for (int i{ 0 }; i < m_n; ++i)
+                    {
+                        const int cell{ byColumn ? (i * m_n + line) : (line * m_n + i) };
+                        if (i / m_boxSize != b && !eliminate(cell, pointing))
+                            return false;
+                    }
+
+                    for (int l2{ band * m_boxSize }; l2 < (band + 1) * m_boxSize; ++l2)
+                    {
+                        if (l2 == line)
+                            continue;
+                        for (int i{ b * m_boxSize }; i < (b + 1) * m_boxSize; ++i)
+                        {
+                            const int cell{ byColumn ? (i * m_n + l2) : (l2 * m_n + i) };
+                            if (!eliminate(cell, claiming))
+                                return false;
+                        }
+                    }
+
+                    /* Keep our segment table honest for the rest
+                    of this pass: */
+                    for (int b2{ 0 }; b2 < m_boxSize; ++b2)
+                    {
+                        if (b2 != b)
+                            segment[line][b2] &= static_cast<mask_t>(~pointing);
+                    }
+                    for (int l2{ band * m_boxSize }; l2 < (band + 1) * m_boxSize; ++l2)
+                    {
+                        if (l2 != line)
+                            segment[l2][b] &= static_cast<mask_t>(~claiming);
+                    }
+
+                    changed = true;
+                }
+            }
+
+            if (!assignSingles())
+                return false;
+        }
+
+        return true;
+    }
+
+
+    /* Runs naked singles, hidden singles and locked
+    candidates until none of them changes anything.
+    Returns false on a contradiction. */
+    bool propagate()
+    {
+        bool changed{ true };
+        while (changed && m_numEmpty > 0)
+        {
+            changed = false;
+
+            if (!assignSingles())
+                return false;
+            if (!findHiddenSingles(changed))
+                return false;
+            if (changed)
+                continue;
+            if (!findLockedCandidates(changed))
+                return false;
+        }
+
+        return true;
+    }
+
+
+    /* The "empty" cell with the fewest candidates: */
+    int chooseBranchCell() const
+    {
+        int best{ -1 };
+        int bestCount{ maxMaskN + 1 };
+
+        for (int cell{ 0 }; cell < m_n * m_n; ++cell)
+        {
+            if (m_cells[cell] != 0)
+                continue;
+
+            const int count{ countCandidates(m_candidates[cell]) };
+            if (count < bestCount)
+            {
+                best = cell;
+                bestCount = count;
+                if (count <= 2)
+                    break;
+            }
+        }
+
+        return best;
+    }
+
+
+    /* Propagation plus iterative backtracking on the
+    "empty" cell with the fewest candidates.  On reaching
+    a solution the search records it and, if fewer than
+    maxSolutions have been found, simply carries on with
+    the next guess, so counting reuses the same trail and
+    depth arrays rather than starting again. */
+    int_fast64_t searchBitmask(int_fast64_t maxSolutions)
+    {
+        if (!m_consistent || !propagate())
+            return 0;
+
+        if (m_numEmpty == 0)
+            return 1;
+
+        int_fast64_t found{ 0 };
+        int depth{ 0 };
+        m_branchCell[0] = static_cast<int16_t>(chooseBranchCell());
+        m_branchCandidates[0] = m_candidates[m_branchCell[0]];
+        m_branchTrail[0] = m_trailSize;
+
+        while (depth >= 0)
+        {
+            /* Undo whatever the last guess at this depth did: */
+            undoTrail(m_branchTrail[depth]);
+
+            mask_t& candidates{ m_branchCandidates[depth] };
+
+            /* No candidates left, so backtrack a level: */
+            if (candidates == 0)
+            {
+                --depth;
+                continue;
+            }
+
+            /* Assume the lowest remaining candidate: */
+            const int val{ lowestCandidate(candidates) + 1 };
+            candidates &= static_cast<mask_t>(candidates - 1);
+            ++m_stats.nodes;
+
+            if (!assign(m_branchCell[depth], val) || !propagate())
+            {
+                ++m_stats.backtracks;
+                continue;
+            }
+
+            if (m_numEmpty == 0)
+            {
+                if (++found == 1)
+                {
+                    for (int cell{ 0 }; cell < m_n * m_n; ++cell)
+                        m_solution[cell] = m_cells[cell];
+                }
+
+                /* The first solution is the current state, so
+                it can be returned as it is: */
+                if (found == maxSolutions)
+                    break;
+                continue;
+            }
+
+            ++depth;
+            if (depth > m_stats.maxDepth)
+                m_stats.maxDepth = depth;
+
+            m_branchCell[depth] = static_cast<int16_t>(chooseBranchCell());
+            m_branchCandidates[depth] = m_candidates[m_branchCell[depth]];
+            m_branchTrail[depth] = m_trailSize;
+        }
+
+        /* Otherwise put the first solution back in place of
+        wherever the search stopped: */
+        if (found > 1 || (found == 1 && m_numEmpty != 0))
+        {
+            for (int cell{ 0 }; cell < m_n * m_n; ++cell)
+            {
+                m_cells[cell] = m_solution[cell];
+                m_candidates[cell] = static_cast<mask_t>(1u << (m_solution[cell] - 1));
+            }
+            m_numEmpty = 0;
+            m_trailSize = 0;
+            m_numSingles = 0;
+        }
+
+        return found;
+    }
+
+
+public:
+    /* Constructor making an empty 9x9 matrix (i.e. all
+    cells full of potential values): */
+    SuDukoNxN()
+    {
+        setSize(9);
+        reduceMatrix();
+    }
+
+    /* Used to import an existing matrix; zero values
+    are "empty" cells.  N must be a square (4, 9, 16
+    or 25) so that the boxes are sqrt(N)xsqrt(N). */
+    SuDukoNxN(const int& n, const std::vector<std::vector<int>>& matrix)
+    {
+        setSize(n);
+
+        for (int k{ 0 }; k < n; ++k)
+        {
+            for (int j{ 0 }; j < n; ++j)
+            {
+                m_cells[k * n + j] = static_cast<int_fast8_t>(matrix.at(k).at(j));
+            }
+        }
+
+        reduceMatrix();
+    }
+
+
+    /* Replaces the matrix with n*n row-major values
+    (zero for "empty" cells) and reduces it; this lets
+    one object be reused for many puzzles without
+    allocating anything: */
+    void loadMatrix(const int& n, const int_fast8_t* values)
+    {
+        if (n != m_n)
+            setSize(n);
+
+        for (int cell{ 0 }; cell < n * n; ++cell)
+        {
+            m_cells[cell] = values[cell];
+        }
+
+        reduceMatrix();
+    }
+
+
+    int getN() const { return m_n; }
+
+    /* Value of cell (row, col), zero if "empty": */
+    int getCell(int row, int col) const { return m_cells[row * m_n + col]; }
+
+    const SolverStats& getStats() const { return m_stats; }
+
+    /* Chooses the search run by solveSuDukoNxN() and
+    re-reduces the current matrix for it: */
+    void setBackend(SuDokuBackend backend)
+    {
+        m_backend = backend;
+        reduceMatrix();
+    }
+    SuDokuBackend getBackend() const { return m_backend; }
+
+
+    /* Function to print out a given Sudoku matrix: */
+    void printSuDokuMatrix() const
+    {
+        for (int k{ 0 }; k < getN(); ++k)
+        {
+            for (int j{ 0 }; j < getN(); ++j)
+            {
+                std::cout << getCell(k, j) << " ";
+            }
+            std::cout << "\n";
+        }
+        std::cout << "\n";
+    }
+
+
+    /* Candidate mask of cell (row, col): */
+    mask_t getCandidates(int row, int col) const { return m_candidates[row * m_n + col]; }
+
+
+    /* Member function that checks whether a given value
+    is still possible for the cell (row, col): */
+    bool checkValAgainstAll(const int& val, const int& row, const int& col) const
+    {
+        return (getCandidates(row, col) >> (val - 1)) & 1u;
+    }
+
+
+    /* Resets every cell to all values and assigns the
+    "filled" cells, removing their values from their
+    rows, columns and boxes.  Flags the matrix as
+    inconsistent if the given values break the rules: */
+    void reduceMatrix()
+    {
+        /* Dancing links only needs the values checked here;
+        clashing givens are caught when they are selected: */
+        if (usesDancingLinks())
+        {
+            m_consistent = true;
+            for (int cell{ 0 }; cell < m_n * m_n; ++cell)
+            {
+                if (m_cells[cell] < 0 || m_cells[cell] > m_n)
+                    m_consistent = false;
+            }
+            return;
+        }
+
+        std::array<int_fast8_t, maxMaskCells> givens{};
+        for (int cell{ 0 }; cell < m_n * m_n; ++cell)
+            givens[cell] = m_cells[cell];
+
+        m_consistent = true;
+        m_numEmpty = m_n * m_n;
+        m_trailSize = 0;
+        m_numSingles = 0;
+
+        for (int cell{ 0 }; cell < m_n * m_n; ++cell)
+        {
+            m_cells[cell] = 0;
+            m_candidates[cell] = m_allValues;
+        }
+
+        for (int cell{ 0 }; cell < m_n * m_n; ++cell)
+        {
+            const int val{ givens[cell] };
+
+            if (val < 0 || val > m_n)
+            {
+                m_consistent = false;
+            }
+            else if (val != 0 && !assign(cell, val))
+            {
+                m_consistent = false;
+            }
+        }
+
+        /* The givens are never undone; if they clash, put
+        them all back so the matrix still shows the input: */
+        m_trailSize = 0;
+
+        if (!m_consistent)
+        {
+            for (int cell{ 0 }; cell < m_n * m_n; ++cell)
+                m_cells[cell] = givens[cell];
+        }
+    }
+
+
+    /* Member function to solve a SuDoku matrix.
+    Ensure that reduceMatrix() has been called since
+    the last change to the cells (the constructors
+    already do this). */
+    bool solveSuDukoNxN()
+    {
+        return countSolutions(1) > 0;
+    }
+
+
+    /* Counts the solutions of the matrix, stopping as soon
+    as maxSolutions have been found; so with the default
+    cap of 2 the answer is 0 (no solution), 1 (a unique
+    solution) or 2 (more than one).  This is the same
+    search as solveSuDukoNxN(), which simply stops at
+    the first solution, so checking a puzzle costs little
+    more than solving it.  The first solution found is
+    left in the matrix.  As with solveSuDukoNxN(), call
+    this on a freshly loaded (reduced) matrix. */
+    int_fast64_t countSolutions(int_fast64_t maxSolutions = 2)
+    {
+        m_stats = {};
+
+        if (maxSolutions <= 0)
+            return 0;
+
+        if (usesDancingLinks())
+            return searchByDancingLinks(maxSolutions);
+
+        return searchBitmask(maxSolutions);
+    }
+
+
+    bool hasUniqueSolution() { return countSolutions(2) == 1; }
+
+
+    /* Member function returning the first three
+    cells (0,0), (0,1), (0,2) as a 3-digit number: */
+    lint_t getFirst3digNum() const
+    {
+        return static_cast<lint_t>((getCell(0, 0) * 100)
+            + (getCell(0, 1) * 10)
+            + getCell(0, 2));
+    }
+};
+
+#endif
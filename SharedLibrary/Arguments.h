@@ -0,0 +1,43 @@
+/* Checked reading of numeric command-line arguments, shared
+   between problems; accessed through #include "../SharedLibrary/Arguments.h" */
+
+#ifndef SHAREDLIBRARY_ARGUMENTS_H
+#define SHAREDLIBRARY_ARGUMENTS_H
+
+#include <cstdint> // For large integer (non-digit) types.
+
+
+/* Reads text as a whole decimal number from minimum to
+maximum into value.  Unlike std::stoull(), which throws on
+text that is not a number, skips leading spaces, stops
+quietly at trailing junk and wraps "-1" round to UINT64_MAX,
+anything but plain digits is refused: returns false (with
+value left alone) if text is empty, has any other character
+in it, overflows 64 bits or is out of range, so the caller
+can report the argument and stop. */
+inline bool parseArgument(const char* text, uint64_t minimum, uint64_t maximum, uint64_t& value)
+{
+    if (text == nullptr || *text == '\0')
+        return false;
+
+    uint64_t parsed{ 0 };
+    for (const char* c{ text }; *c != '\0'; ++c)
+    {
+        if (*c < '0' || *c > '9')
+            return false;
+
+        const uint64_t digit{ static_cast<uint64_t>(*c - '0') };
+        if (parsed > (UINT64_MAX - digit) / 10)
+            return false;
+        parsed = 10 * parsed + digit;
+    }
+
+    if (parsed < minimum || parsed > maximum)
+        return false;
+
+    value = parsed;
+    return true;
+}
+
+
+#endif
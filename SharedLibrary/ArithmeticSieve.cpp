@@ -0,0 +1,124 @@
+/* Arithmetic function tables (spf, phi, mu, d, sigma), shared between
+   problems; accessed through #include "../SharedLibrary/ArithmeticSieve.h" */
+
+#include "ArithmeticSieve.h"
+
+#include <cstddef> // For std::size_t.
+
+
+/* Fills the requested tables (see SieveTables) for every
+n up to limit in one linear pass. */
+ArithmeticSieve::ArithmeticSieve(uint32_t limit, unsigned tables)
+    : m_limit{ limit }, m_tables{ tables }
+{
+    const std::size_t size{ static_cast<std::size_t>(limit) + 1 };
+
+    m_composite.assign(size, false);
+    if (hasTables(sieveSpf))
+        m_spf.assign(size, 0);
+    if (hasTables(sievePhi))
+        m_phi.assign(size, 0);
+    if (hasTables(sieveMu))
+        m_mu.assign(size, 0);
+    if (hasTables(sieveDivisorCount))
+        m_divisorCount.assign(size, 0);
+    if (hasTables(sieveDivisorSum))
+        m_divisorSum.assign(size, 0);
+
+    /* Only needed while sieving: the exponent e of the
+    smallest prime p of n (for d) and 1 + p + ... + p^e
+    (for sigma): */
+    std::vector<uint8_t> spfExponent{};
+    std::vector<uint64_t> spfPowerSum{};
+    if (hasTables(sieveDivisorCount))
+        spfExponent.assign(size, 0);
+    if (hasTables(sieveDivisorSum))
+        spfPowerSum.assign(size, 0);
+
+    if (limit >= 1)
+    {
+        if (hasTables(sieveSpf))
+            m_spf[1] = 1;
+        if (hasTables(sievePhi))
+            m_phi[1] = 1;
+        if (hasTables(sieveMu))
+            m_mu[1] = 1;
+        if (hasTables(sieveDivisorCount))
+            m_divisorCount[1] = 1;
+        if (hasTables(sieveDivisorSum))
+            m_divisorSum[1] = 1;
+    }
+
+    for (uint64_t i{ 2 }; i <= limit; ++i)
+    {
+        if (!m_composite[i])
+        {
+            m_primes.push_back(static_cast<uint32_t>(i));
+
+            if (hasTables(sieveSpf))
+                m_spf[i] = static_cast<uint32_t>(i);
+            if (hasTables(sievePhi))
+                m_phi[i] = static_cast<uint32_t>(i - 1);
+            if (hasTables(sieveMu))
+                m_mu[i] = -1;
+            if (hasTables(sieveDivisorCount))
+            {
+                m_divisorCount[i] = 2;
+                spfExponent[i] = 1;
+            }
+            if (hasTables(sieveDivisorSum))
+            {
+                m_divisorSum[i] = i + 1;
+                spfPowerSum[i] = i + 1;
+            }
+        }
+
+        /* Cross off i * p for every prime p up to (and
+        including) the smallest prime factor of i, each of
+        which then has p as its smallest prime factor: */
+        for (uint32_t p : m_primes)
+        {
+            const uint64_t n{ i * p };
+            if (n > limit)
+                break;
+
+            m_composite[n] = true;
+            if (hasTables(sieveSpf))
+                m_spf[n] = p;
+
+            if (i % p == 0)
+            {
+                if (hasTables(sievePhi))
+                    m_phi[n] = m_phi[i] * p;
+                /* m_mu[n] stays 0. */
+                if (hasTables(sieveDivisorCount))
+                {
+                    spfExponent[n] = static_cast<uint8_t>(spfExponent[i] + 1);
+                    m_divisorCount[n] = static_cast<uint16_t>(
+                        m_divisorCount[i] / (spfExponent[i] + 1) * (spfExponent[i] + 2));
+                }
+                if (hasTables(sieveDivisorSum))
+                {
+                    spfPowerSum[n] = spfPowerSum[i] * p + 1;
+                    m_divisorSum[n] = m_divisorSum[i] / spfPowerSum[i] * spfPowerSum[n];
+                }
+                break;
+            }
+
+            if (hasTables(sievePhi))
+                m_phi[n] = m_phi[i] * (p - 1);
+            if (hasTables(sieveMu))
+                m_mu[n] = static_cast<int8_t>(-m_mu[i]);
+            if (hasTables(sieveDivisorCount))
+            {
+                spfExponent[n] = 1;
+                m_divisorCount[n] = static_cast<uint16_t>(m_divisorCount[i] * 2);
+            }
+            if (hasTables(sieveDivisorSum))
+            {
+                spfPowerSum[n] = p + 1;
+                m_divisorSum[n] = m_divisorSum[i] * (p + 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/* Arithmetic function tables (spf, phi, mu, d, sigma), shared between
+   problems; accessed through #include "../SharedLibrary/ArithmeticSieve.h" */
+
+#ifndef SHAREDLIBRARY_ARITHMETICSIEVE_H
+#define SHAREDLIBRARY_ARITHMETICSIEVE_H
+
+#include <cassert>
+#include <cstdint> // For large integer (non-digit) types.
+#include <vector>
+
+
+/* Which tables an ArithmeticSieve fills (OR these together);
+the primes and a composite bitmap are always kept: */
+enum SieveTables : unsigned
+{
+    sieveSpf = 1u << 0,           // Smallest prime factor.
+    sievePhi = 1u << 1,           // Euler's totient.
+    sieveMu = 1u << 2,            // Moebius function.
+    sieveDivisorCount = 1u << 3,  // d(n), the number of divisors.
+    sieveDivisorSum = 1u << 4,    // sigma(n), the sum of divisors.
+};
+
+
+/* Linear (Euler) sieve over 0..limit.  Every composite n is
+crossed off exactly once, as n = i * p with p the smallest
+prime factor of n, and since every function here is
+multiplicative its value at n follows from its value at i
+in O(1):
+    if p does not divide i:  f(n) = f(i) * f(p)
+    if p divides i:          phi(n) = phi(i) * p, mu(n) = 0,
+                             and d, sigma are updated through
+                             the exponent (and 1 + p + ... + p^e)
+                             of p in i.
+So all requested tables are filled in one O(limit) pass.
+
+Each table takes the narrowest type that holds it for any
+limit below 2^32: 32 bits for spf and phi, 8 for mu, 16
+for d(n) (at most 1344 there) and 64 for sigma(n).  Tables
+not asked for take no memory at all; n = 0 and 1 hold 0 and
+the usual values (phi(1) = mu(1) = d(1) = sigma(1) = 1). */
+class ArithmeticSieve
+{
+private:
+    uint32_t m_limit{};
+    unsigned m_tables{};
+
+    std::vector<uint32_t> m_primes{};
+    std::vector<bool> m_composite{};
+
+    std::vector<uint32_t> m_spf{};
+    std::vector<uint32_t> m_phi{};
+    std::vector<int8_t> m_mu{};
+    std::vector<uint16_t> m_divisorCount{};
+    std::vector<uint64_t> m_divisorSum{};
+
+public:
+    explicit ArithmeticSieve(uint32_t limit, unsigned tables = sieveSpf | sievePhi | sieveMu);
+
+    uint32_t getLimit() const { return m_limit; }
+    bool hasTables(unsigned tables) const { return (m_tables & tables) == tables; }
+
+    /* All primes up to the limit, in increasing order: */
+    const std::vector<uint32_t>& getPrimes() const { return m_primes; }
+
+    bool isPrime(uint32_t n) const
+    {
+        assert(n <= m_limit);
+        return n >= 2 && !m_composite[n];
+    }
+
+    uint32_t spf(uint32_t n) const { assert(hasTables(sieveSpf) && n <= m_limit); return m_spf[n]; }
+    uint32_t phi(uint32_t n) const { assert(hasTables(sievePhi) && n <= m_limit); return m_phi[n]; }
+    int mu(uint32_t n) const { assert(hasTables(sieveMu) && n <= m_limit); return m_mu[n]; }
+    uint32_t divisorCount(uint32_t n) const { assert(hasTables(sieveDivisorCount) && n <= m_limit); return m_divisorCount[n]; }
+    uint64_t divisorSum(uint32_t n) const { assert(hasTables(sieveDivisorSum) && n <= m_limit); return m_divisorSum[n]; }
+
+    /* The whole tables, indexed by n, for tight loops: */
+    const std::vector<uint32_t>& getSpfTable() const { return m_spf; }
+    const std::vector<uint32_t>& getPhiTable() const { return m_phi; }
+    const std::vector<int8_t>& getMuTable() const { return m_mu; }
+};
+
+#endif
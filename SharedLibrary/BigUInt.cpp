@@ -0,0 +1,221 @@
+/* Arbitrary-precision unsigned integer, shared between problems;
+   accessed through #include "../SharedLibrary/BigUInt.h" */
+
+#include "BigUInt.h"
+
+#include <cassert>
+#include <cmath> // For std::log10(), std::ldexp().
+#include <limits>
+
+#include "UInt128.h"
+
+
+uint64_t BigUInt::bitLength() const
+{
+    if (m_limbs.empty())
+        return 0;
+
+    uint64_t top{ m_limbs.back() };
+    uint64_t bits{ 64 * (m_limbs.size() - 1) };
+    while (top != 0)
+    {
+        top >>= 1;
+        ++bits;
+    }
+    return bits;
+}
+
+
+double BigUInt::log10() const
+{
+    if (m_limbs.empty())
+        return -std::numeric_limits<double>::infinity();
+    if (m_limbs.size() == 1)
+        return std::log10(static_cast<double>(m_limbs[0]));
+
+    const std::size_t n{ m_limbs.size() };
+    const double leading{ std::ldexp(static_cast<double>(m_limbs[n - 1]), 64)
+        + static_cast<double>(m_limbs[n - 2]) };
+    return std::log10(leading) + 64.0 * static_cast<double>(n - 2) * 0.30102999566398120;
+}
+
+
+BigUInt& BigUInt::addMultiple(const BigUInt& other, uint64_t factor)
+{
+    if (factor == 0 || other.m_limbs.empty())
+        return *this;
+
+    /* other may be *this: each of its limbs is read before
+    the same limb is written. */
+    const std::size_t otherSize{ other.m_limbs.size() };
+    if (m_limbs.size() < otherSize)
+        m_limbs.resize(otherSize, 0);
+
+    uint64_t carry{ 0 };
+    for (std::size_t i{ 0 }; i < otherSize; ++i)
+    {
+        /* a * b + c + d never overflows 128 bits: */
+        UInt128 sum{ UInt128::multiply(other.m_limbs[i], factor) };
+        sum += UInt128{ carry };
+        sum += UInt128{ m_limbs[i] };
+        m_limbs[i] = sum.low();
+        carry = sum.high();
+    }
+
+    for (std::size_t i{ otherSize }; carry != 0; ++i)
+    {
+        if (i == m_limbs.size())
+        {
+            m_limbs.push_back(carry);
+            break;
+        }
+        m_limbs[i] += carry;
+        carry = (m_limbs[i] < carry) ? 1 : 0;
+    }
+
+    return *this;
+}
+
+
+BigUInt& BigUInt::operator+=(uint64_t value)
+{
+    for (std::size_t i{ 0 }; value != 0; ++i)
+    {
+        if (i == m_limbs.size())
+        {
+            m_limbs.push_back(value);
+            break;
+        }
+        m_limbs[i] += value;
+        value = (m_limbs[i] < value) ? 1 : 0;
+    }
+    return *this;
+}
+
+
+BigUInt& BigUInt::operator-=(const BigUInt& other)
+{
+    assert(compare(*this, other) >= 0);
+
+    uint64_t borrow{ 0 };
+    for (std::size_t i{ 0 }; i < m_limbs.size() && (i < other.m_limbs.size() || borrow != 0); ++i)
+    {
+        const uint64_t subtrahend{ (i < other.m_limbs.size()) ? other.m_limbs[i] : 0 };
+        const uint64_t difference{ m_limbs[i] - subtrahend - borrow };
+        borrow = (m_limbs[i] < subtrahend || (m_limbs[i] == subtrahend && borrow != 0)) ? 1 : 0;
+        m_limbs[i] = difference;
+    }
+
+    trim();
+    return *this;
+}
+
+
+BigUInt& BigUInt::operator*=(uint64_t factor)
+{
+    if (factor == 0)
+    {
+        m_limbs.clear();
+        return *this;
+    }
+
+    uint64_t carry{ 0 };
+    for (uint64_t& limb : m_limbs)
+    {
+        UInt128 product{ UInt128::multiply(limb, factor) };
+        product += UInt128{ carry };
+        limb = product.low();
+        carry = product.high();
+    }
+    if (carry != 0)
+        m_limbs.push_back(carry);
+
+    return *this;
+}
+
+
+BigUInt& BigUInt::operator*=(const BigUInt& other)
+{
+    if (m_limbs.empty() || other.m_limbs.empty())
+    {
+        m_limbs.clear();
+        return *this;
+    }
+
+    std::vector<uint64_t> product(m_limbs.size() + other.m_limbs.size(), 0);
+    for (std::size_t i{ 0 }; i < m_limbs.size(); ++i)
+    {
+        uint64_t carry{ 0 };
+        for (std::size_t j{ 0 }; j < other.m_limbs.size(); ++j)
+        {
+            UInt128 sum{ UInt128::multiply(m_limbs[i], other.m_limbs[j]) };
+            sum += UInt128{ carry };
+            sum += UInt128{ product[i + j] };
+            product[i + j] = sum.low();
+            carry = sum.high();
+        }
+        product[i + other.m_limbs.size()] = carry;
+    }
+
+    m_limbs.swap(product);
+    trim();
+    return *this;
+}
+
+
+uint32_t BigUInt::divideBy(uint32_t divisor)
+{
+    assert(divisor != 0);
+
+    /* Two 32-bit "digits" per limb, from the top down: */
+    uint64_t remainder{ 0 };
+    for (std::size_t i{ m_limbs.size() }; i-- > 0; )
+    {
+        const uint64_t high{ (remainder << 32) | (m_limbs[i] >> 32) };
+        remainder = high % divisor;
+        const uint64_t low{ (remainder << 32) | (m_limbs[i] & 0xFFFFFFFF) };
+        remainder = low % divisor;
+        m_limbs[i] = ((high / divisor) << 32) | (low / divisor);
+    }
+
+    trim();
+    return static_cast<uint32_t>(remainder);
+}
+
+
+std::string BigUInt::toString() const
+{
+    if (m_limbs.size() <= 1)
+        return std::to_string(m_limbs.empty() ? 0 : m_limbs[0]);
+
+    /* Peel off 9 decimal digits at a time, into chunks
+    least significant first: */
+    std::vector<uint32_t> chunks{};
+    BigUInt rest{ *this };
+    while (rest.m_limbs.size() > 1)
+        chunks.push_back(rest.divideBy(1000000000));
+
+    std::string result{ std::to_string(rest.isZero() ? 0 : rest.m_limbs[0]) };
+    result.reserve(result.size() + 9 * chunks.size());
+    for (std::size_t i{ chunks.size() }; i-- > 0; )
+    {
+        const std::string chunk{ std::to_string(chunks[i]) };
+        result.append(9 - chunk.size(), '0');
+        result += chunk;
+    }
+    return result;
+}
+
+
+int BigUInt::compare(const BigUInt& a, const BigUInt& b)
+{
+    if (a.m_limbs.size() != b.m_limbs.size())
+        return (a.m_limbs.size() < b.m_limbs.size()) ? -1 : 1;
+
+    for (std::size_t i{ a.m_limbs.size() }; i-- > 0; )
+    {
+        if (a.m_limbs[i] != b.m_limbs[i])
+            return (a.m_limbs[i] < b.m_limbs[i]) ? -1 : 1;
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+/* Arbitrary-precision unsigned integer, shared between problems;
+   accessed through #include "../SharedLibrary/BigUInt.h" */
+
+#ifndef SHAREDLIBRARY_BIGUINT_H
+#define SHAREDLIBRARY_BIGUINT_H
+
+#include <cstddef> // For std::size_t.
+#include <cstdint> // For large integer (non-digit) types.
+#include <ostream>
+#include <string> // For std::string.
+#include <vector>
+
+
+/* Unsigned integer of any size, as 64-bit "limbs" (least
+significant first, never with leading zero limbs, so zero
+has no limbs at all).  Every limb product goes through
+UInt128::multiply(), i.e. one multiply instruction where
+the compiler allows.
+
+The solutions mostly need recurrences like convergents,
+    h_(n+1) = a_(n+1) * h_n + h_(n-1),
+with a small a, which addMultiple() does in place in one
+pass (h_(n-1) becomes h_(n+1)), so the numbers are never
+copied and their storage only ever grows.  The full product
+and the decimal conversion are plain O(n * m) and O(n^2)
+schoolbook methods, which is plenty for a few thousand
+digits. */
+class BigUInt
+{
+private:
+    std::vector<uint64_t> m_limbs{};
+
+    void trim()
+    {
+        while (!m_limbs.empty() && m_limbs.back() == 0)
+            m_limbs.pop_back();
+    }
+
+public:
+    BigUInt() = default;
+    BigUInt(uint64_t value)
+    {
+        if (value != 0)
+            m_limbs.push_back(value);
+    }
+
+    bool isZero() const { return m_limbs.empty(); }
+    std::size_t limbCount() const { return m_limbs.size(); }
+    const std::vector<uint64_t>& getLimbs() const { return m_limbs; }
+
+    /* Number of bits, i.e. floor(log2) + 1 (0 for zero): */
+    uint64_t bitLength() const;
+
+    /* log10 of the value from its leading 128 bits (about 16
+    significant digits; -infinity for zero): */
+    double log10() const;
+
+    /* *this += other * factor, in one pass: */
+    BigUInt& addMultiple(const BigUInt& other, uint64_t factor);
+
+    BigUInt& operator+=(const BigUInt& other) { return addMultiple(other, 1); }
+    BigUInt& operator+=(uint64_t value);
+
+    /* other must not be larger than *this: */
+    BigUInt& operator-=(const BigUInt& other);
+
+    BigUInt& operator*=(uint64_t factor);
+    BigUInt& operator*=(const BigUInt& other);
+
+    /* Divides in place by a 32-bit divisor; returns the
+    remainder: */
+    uint32_t divideBy(uint32_t divisor);
+
+    std::string toString() const;
+
+    /* Number of decimal digits (1 for zero): */
+    std::size_t countDecimalDigits() const { return toString().size(); }
+
+    /* -1, 0 or 1 as a is below, equal to or above b: */
+    static int compare(const BigUInt& a, const BigUInt& b);
+
+    friend BigUInt operator+(BigUInt a, const BigUInt& b) { return a += b; }
+    friend BigUInt operator-(BigUInt a, const BigUInt& b) { return a -= b; }
+    friend BigUInt operator*(BigUInt a, uint64_t b) { return a *= b; }
+    friend BigUInt operator*(const BigUInt& a, const BigUInt& b) { BigUInt product{ a }; return product *= b; }
+
+    friend bool operator==(const BigUInt& a, const BigUInt& b) { return a.m_limbs == b.m_limbs; }
+    friend bool operator!=(const BigUInt& a, const BigUInt& b) { return !(a == b); }
+    friend bool operator<(const BigUInt& a, const BigUInt& b) { return compare(a, b) < 0; }
+    friend bool operator>(const BigUInt& a, const BigUInt& b) { return compare(a, b) > 0; }
+    friend bool operator<=(const BigUInt& a, const BigUInt& b) { return compare(a, b) <= 0; }
+    friend bool operator>=(const BigUInt& a, const BigUInt& b) { return compare(a, b) >= 0; }
+
+    friend std::ostream& operator<<(std::ostream& out, const BigUInt& value)
+    {
+        return out << value.toString();
+    }
+};
+
+#endif
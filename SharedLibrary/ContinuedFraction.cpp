@@ -0,0 +1,158 @@
+/* Continued fractions of square roots, shared between problems;
+   accessed through #include "../SharedLibrary/ContinuedFraction.h" */
+
+#include "ContinuedFraction.h"
+
+#include <algorithm> // For std::max(), std::min().
+#include <atomic>
+#include <functional> // For std::function.
+#include <thread>
+
+#include "Polygonal.h" // For isqrt().
+
+
+namespace
+{
+    /* x / d for the usual case of a small quotient (a_i is
+    1, 2 or 3 most of the time), skipping the division: */
+    inline uint64_t smallQuotient(uint64_t x, uint64_t d)
+    {
+        if (x < d)
+            return 0;
+        if (x < 2 * d)
+            return 1;
+        if (x < 3 * d)
+            return 2;
+        if (x < 4 * d)
+            return 3;
+        return x / d;
+    }
+}
+
+
+uint64_t floorSqrt(uint64_t n)
+{
+    return isqrt(n);
+}
+
+
+void forEachDChunk(uint64_t maxD, unsigned numThreads,
+    const std::function<void(uint64_t, uint64_t)>& work)
+{
+    constexpr uint64_t chunkSize{ 4096 };
+
+    if (numThreads == 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::atomic<uint64_t> next{ 2 };
+    auto worker = [&]()
+    {
+        while (true)
+        {
+            const uint64_t first{ next.fetch_add(chunkSize) };
+            if (first > maxD)
+                return;
+            work(first, std::min(maxD, first + chunkSize - 1));
+        }
+    };
+
+    std::vector<std::thread> pool{};
+    for (unsigned t{ 1 }; t < numThreads; ++t)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread& t : pool)
+        t.join();
+}
+
+
+SqrtContinuedFraction expandSqrt(uint64_t D)
+{
+    SqrtContinuedFraction result{};
+    result.D = D;
+    result.a0 = floorSqrt(D);
+
+    if (result.a0 * result.a0 == D)
+        return result;
+
+    uint64_t m{ 0 };
+    uint64_t d{ 1 };
+    uint64_t a{ result.a0 };
+    do
+    {
+        m = d * a - m;
+        d = (D - m * m) / d;
+        a = (result.a0 + m) / d;
+        result.period.push_back(a);
+    } while (a != 2 * result.a0);
+
+    return result;
+}
+
+
+/* The (m, d) pairs of a period read the same backwards, so
+the period can be told from its middle: going from step k
+to k + 1 (counting the first step after a0 as 1), an equal
+m means the period is 2k and an equal d means 2k + 1.  The
+division for d' is also replaced by the equivalent
+    d' = d_prev + a * (m - m')
+(unsigned wrap-around makes the negative m - m' work out). */
+uint64_t sqrtPeriodLength(uint64_t D)
+{
+    const uint64_t a0{ floorSqrt(D) };
+    if (a0 * a0 == D)
+        return 0;
+
+    /* Step 1: */
+    uint64_t m{ a0 };
+    uint64_t previousD{ 1 };
+    uint64_t d{ D - a0 * a0 };
+    if (d == 1)
+        return 1;
+    uint64_t a{ (a0 + m) / d };
+
+    for (uint64_t k{ 1 }; ; ++k)
+    {
+        const uint64_t nextM{ d * a - m };
+        const uint64_t nextD{ previousD + a * (m - nextM) };
+
+        if (nextM == m)
+            return 2 * k;
+        if (nextD == d)
+            return 2 * k + 1;
+
+        a = smallQuotient(a0 + nextM, nextD);
+        m = nextM;
+        previousD = d;
+        d = nextD;
+    }
+}
+
+
+std::vector<uint32_t> sqrtPeriodLengths(uint64_t maxD, unsigned numThreads)
+{
+    std::vector<uint32_t> lengths(static_cast<std::size_t>(maxD) + 1, 0);
+
+    forEachDChunk(maxD, numThreads, [&](uint64_t first, uint64_t last)
+    {
+        for (uint64_t D{ first }; D <= last; ++D)
+            lengths[static_cast<std::size_t>(D)] = static_cast<uint32_t>(sqrtPeriodLength(D));
+    });
+
+    return lengths;
+}
+
+
+uint64_t countOddSqrtPeriods(uint64_t maxD, unsigned numThreads)
+{
+    std::atomic<uint64_t> total{ 0 };
+
+    forEachDChunk(maxD, numThreads, [&](uint64_t first, uint64_t last)
+    {
+        uint64_t count{ 0 };
+        for (uint64_t D{ first }; D <= last; ++D)
+            count += sqrtPeriodLength(D) & 1;
+        total += count;
+    });
+
+    return total;
+}
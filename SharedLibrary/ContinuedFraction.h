@@ -0,0 +1,57 @@
+/* Continued fractions of square roots, shared between problems;
+   accessed through #include "../SharedLibrary/ContinuedFraction.h" */
+
+#ifndef SHAREDLIBRARY_CONTINUEDFRACTION_H
+#define SHAREDLIBRARY_CONTINUEDFRACTION_H
+
+#include <cstdint> // For large integer (non-digit) types.
+#include <functional> // For std::function.
+#include <vector>
+
+
+/* sqrt(D) = [a0; (period[0], period[1], ...)], the period
+repeating forever.  For a perfect square the period is
+empty and sqrt(D) = a0 exactly. */
+struct SqrtContinuedFraction
+{
+    uint64_t D{};
+    uint64_t a0{};
+    std::vector<uint64_t> period{};
+
+    /* The i-th partial quotient a_i (a_0 = a0): */
+    uint64_t term(uint64_t i) const
+    {
+        return (i == 0 || period.empty()) ? a0 : period[(i - 1) % period.size()];
+    }
+};
+
+
+/* Largest r with r * r <= n: */
+uint64_t floorSqrt(uint64_t n);
+
+/* Calls work(first, last) over [2, maxD] in chunks of 4096
+D, each taken by whichever of numThreads threads (0 for one
+per core) is free, since the periods (and so the cost) grow
+with D: */
+void forEachDChunk(uint64_t maxD, unsigned numThreads,
+    const std::function<void(uint64_t, uint64_t)>& work);
+
+/* Every step of the expansion is the integer recurrence
+    m' = d * a - m,  d' = (D - m'^2) / d,  a' = (a0 + m') / d'
+from m = 0, d = 1, a = a0; all three stay below 2 sqrt(D),
+so D may go up to 2^62.  The period ends with the first
+a == 2 * a0. */
+SqrtContinuedFraction expandSqrt(uint64_t D);
+
+/* Just the period length (0 for squares), found at the
+middle of the period without storing anything: */
+uint64_t sqrtPeriodLength(uint64_t D);
+
+/* sqrtPeriodLength(D) for every D <= maxD (index D), on
+numThreads threads (0 uses one per core): */
+std::vector<uint32_t> sqrtPeriodLengths(uint64_t maxD, unsigned numThreads = 0);
+
+/* Number of D <= maxD whose period is odd, without a table: */
+uint64_t countOddSqrtPeriods(uint64_t maxD, unsigned numThreads = 0);
+
+#endif
@@ -0,0 +1,46 @@
+/* Convergents of continued fractions, shared between problems;
+   accessed through #include "../SharedLibrary/Convergents.h" */
+
+#include "Convergents.h"
+
+#include <memory> // For std::shared_ptr.
+#include <utility> // For std::move(), std::swap().
+
+#include "ContinuedFraction.h"
+
+
+ConvergentSequence::ConvergentSequence(PartialQuotients quotients)
+    : m_quotients{ std::move(quotients) }, m_index{ 0 },
+    m_numerator{ m_quotients(0) }, m_denominator{ 1 },
+    m_previousNumerator{ 1 }, m_previousDenominator{ 0 }
+{
+    m_numeratorDigits.update(m_numerator);
+    m_denominatorDigits.update(m_denominator);
+}
+
+
+ConvergentSequence ConvergentSequence::ofSqrt(uint64_t D)
+{
+    /* Shared, so copies of the sequence (and its quotient
+    function) all use the one expansion: */
+    const std::shared_ptr<const SqrtContinuedFraction> expansion{
+        std::make_shared<const SqrtContinuedFraction>(expandSqrt(D)) };
+
+    return ConvergentSequence{ [expansion](uint64_t i) { return expansion->term(i); } };
+}
+
+
+void ConvergentSequence::next()
+{
+    ++m_index;
+    const uint64_t a{ m_quotients(m_index) };
+
+    /* The one before last becomes the newest: */
+    m_previousNumerator.addMultiple(m_numerator, a);
+    m_previousDenominator.addMultiple(m_denominator, a);
+    std::swap(m_numerator, m_previousNumerator);
+    std::swap(m_denominator, m_previousDenominator);
+
+    m_numeratorDigits.update(m_numerator);
+    m_denominatorDigits.update(m_denominator);
+}
@@ -0,0 +1,91 @@
+/* Convergents of continued fractions, shared between problems;
+   accessed through #include "../SharedLibrary/Convergents.h" */
+
+#ifndef SHAREDLIBRARY_CONVERGENTS_H
+#define SHAREDLIBRARY_CONVERGENTS_H
+
+#include <cstddef> // For std::size_t.
+#include <cstdint> // For large integer (non-digit) types.
+#include <functional> // For std::function.
+
+#include "BigUInt.h"
+
+
+/* Decimal digit count of a value that never decreases (the
+numerator or denominator of successive convergents), kept
+up to date without ever converting it to decimal: the
+counter holds the next power of ten, 10^digits, and only
+steps it (times 10) when the value reaches it.  Since
+BigUInt::compare() looks at the limb counts first, almost
+every update() is a single size comparison, and the powers
+of ten cost O(n) each once per digit, so the count never
+costs more than the recurrence that drives it. */
+class DecimalDigitCounter
+{
+private:
+    BigUInt m_nextPowerOfTen{ 10 };
+    std::size_t m_digits{ 1 };
+
+public:
+    /* value must be at least the last value passed in: */
+    std::size_t update(const BigUInt& value)
+    {
+        while (value >= m_nextPowerOfTen)
+        {
+            m_nextPowerOfTen *= 10;
+            ++m_digits;
+        }
+        return m_digits;
+    }
+
+    std::size_t getDigits() const { return m_digits; }
+};
+
+
+/* The i-th partial quotient a_i of a continued fraction
+[a_0; a_1, a_2, ...], for i = 0, 1, 2, ... (every a_i with
+i >= 1 must be positive): */
+using PartialQuotients = std::function<uint64_t(uint64_t)>;
+
+
+/* Successive convergents h_n / k_n of any continued
+fraction, from
+    h_n = a_n h_(n-1) + h_(n-2),  k_n = a_n k_(n-1) + k_(n-2),
+with h_(-1) / k_(-1) = 1 / 0 and h_(-2) / k_(-2) = 0 / 1.
+Each step is one in-place BigUInt::addMultiple() per
+number, i.e. linear in its length, and the digit counts of
+both are tracked along (see DecimalDigitCounter); nothing
+is ever copied or converted to decimal. */
+class ConvergentSequence
+{
+private:
+    PartialQuotients m_quotients{};
+    uint64_t m_index{};
+
+    BigUInt m_numerator{};
+    BigUInt m_denominator{};
+    BigUInt m_previousNumerator{};
+    BigUInt m_previousDenominator{};
+
+    DecimalDigitCounter m_numeratorDigits{};
+    DecimalDigitCounter m_denominatorDigits{};
+
+public:
+    /* Starts at the 0-th convergent, a_0 / 1: */
+    explicit ConvergentSequence(PartialQuotients quotients);
+
+    /* sqrt(D) for a non-square D, through the period from
+    expandSqrt(), expanded once: */
+    static ConvergentSequence ofSqrt(uint64_t D);
+
+    /* Moves on to the next convergent: */
+    void next();
+
+    uint64_t getIndex() const { return m_index; }
+    const BigUInt& getNumerator() const { return m_numerator; }
+    const BigUInt& getDenominator() const { return m_denominator; }
+    std::size_t getNumeratorDigits() const { return m_numeratorDigits.getDigits(); }
+    std::size_t getDenominatorDigits() const { return m_denominatorDigits.getDigits(); }
+};
+
+#endif
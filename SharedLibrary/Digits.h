@@ -0,0 +1,163 @@
+/* Allocation-free decimal digit utilities, shared between problems;
+   accessed through #include "../SharedLibrary/Digits.h" */
+
+#ifndef SHAREDLIBRARY_DIGITS_H
+#define SHAREDLIBRARY_DIGITS_H
+
+#include <array>
+#include <cstdint> // For large integer (non-digit) types.
+#include <string> // For std::string.
+
+
+/* Every uint64_t has at most 20 decimal digits: */
+constexpr int maxDigits{ 20 };
+
+/* Digits of a value on the stack, most significant first: */
+using DigitArray = std::array<uint8_t, maxDigits>;
+
+
+/* Per-pair lookup tables for 00..99, so each loop below
+takes two digits per division (by 100) rather than one: */
+struct DigitPairTables
+{
+    uint8_t tens[100]{};
+    uint8_t ones[100]{};
+    uint8_t sum[100]{};
+    uint8_t reversed[100]{};
+    uint64_t signature[100]{};
+
+    constexpr DigitPairTables()
+    {
+        for (int pair{ 0 }; pair < 100; ++pair)
+        {
+            tens[pair] = static_cast<uint8_t>(pair / 10);
+            ones[pair] = static_cast<uint8_t>(pair % 10);
+            sum[pair] = static_cast<uint8_t>(pair / 10 + pair % 10);
+            reversed[pair] = static_cast<uint8_t>((pair % 10) * 10 + pair / 10);
+            signature[pair] = (uint64_t{ 1 } << (6 * (pair / 10))) + (uint64_t{ 1 } << (6 * (pair % 10)));
+        }
+    }
+};
+
+constexpr DigitPairTables digitPairTables{};
+
+
+/* Number of decimal digits of val (1 for zero): */
+inline int countDigits(uint64_t val)
+{
+    int count{ 1 };
+    while (val >= 100)
+    {
+        val /= 100;
+        count += 2;
+    }
+    return count + ((val >= 10) ? 1 : 0);
+}
+
+
+/* Writes the digits of val into digits, most significant
+first (as printed); returns how many there are: */
+inline int extractDigits(uint64_t val, DigitArray& digits)
+{
+    const int count{ countDigits(val) };
+    int pos{ count };
+
+    while (val >= 100)
+    {
+        const uint64_t pair{ val % 100 };
+        val /= 100;
+        digits[--pos] = digitPairTables.ones[pair];
+        digits[--pos] = digitPairTables.tens[pair];
+    }
+    if (val >= 10)
+    {
+        digits[--pos] = digitPairTables.ones[val];
+        digits[--pos] = digitPairTables.tens[val];
+    }
+    else
+        digits[--pos] = static_cast<uint8_t>(val);
+
+    return count;
+}
+
+
+/* The multiset of digits of val, as the count of each digit
+0-9 in a 6-bit field (digit d at bit 6d).  Two values are
+digit permutations of each other exactly when their
+signatures are equal; leading zeros are not digits, so
+e.g. 120 and 12 differ. */
+inline uint64_t digitSignature(uint64_t val)
+{
+    uint64_t signature{ 0 };
+    while (val >= 100)
+    {
+        signature += digitPairTables.signature[val % 100];
+        val /= 100;
+    }
+    return signature + ((val >= 10) ? digitPairTables.signature[val] : uint64_t{ 1 } << (6 * val));
+}
+
+
+/* As above, counting the characters '0'-'9' of a string
+(anything else is skipped); at most 63 of each digit: */
+inline uint64_t digitSignature(const std::string& str)
+{
+    uint64_t signature{ 0 };
+    for (char c : str)
+    {
+        if (c >= '0' && c <= '9')
+            signature += uint64_t{ 1 } << (6 * (c - '0'));
+    }
+    return signature;
+}
+
+
+/* How many times digit appears in a signature: */
+inline int signatureDigitCount(uint64_t signature, int digit)
+{
+    return static_cast<int>((signature >> (6 * digit)) & 63);
+}
+
+
+inline int digitSum(uint64_t val)
+{
+    int sum{ 0 };
+    while (val >= 100)
+    {
+        sum += digitPairTables.sum[val % 100];
+        val /= 100;
+    }
+    return sum + digitPairTables.sum[val];
+}
+
+
+/* The digits of val in reverse order, e.g. 1230 -> 321.
+Reversing a 20-digit value can overflow (and wraps), so
+check countDigits() first if that matters. */
+inline uint64_t reverseDigits(uint64_t val)
+{
+    uint64_t result{ 0 };
+    while (val >= 100)
+    {
+        result = result * 100 + digitPairTables.reversed[val % 100];
+        val /= 100;
+    }
+    if (val >= 10)
+        return result * 100 + digitPairTables.reversed[val];
+    return result * 10 + val;
+}
+
+
+inline bool isPalindrome(uint64_t val)
+{
+    DigitArray digits;
+    const int count{ extractDigits(val, digits) };
+    for (int i{ 0 }, j{ count - 1 }; i < j; ++i, --j)
+    {
+        if (digits[i] != digits[j])
+            return false;
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,137 @@
+/* Numbers of two polygonal kinds at once, shared between problems;
+   accessed through #include "../SharedLibrary/FigurateIntersection.h" */
+
+#include "FigurateIntersection.h"
+
+#include <cmath> // For std::sqrt(), std::fabs().
+#include <utility> // For std::move().
+
+#include "ContinuedFraction.h"
+#include "Pell.h"
+
+
+PolygonalIntersection::PolygonalIntersection(uint64_t s, uint64_t t)
+    : m_s{ s }, m_t{ t }
+{
+    if (s < 3 || t < 3 || s == t)
+        throw "in PolygonalIntersection(): need two different polygons s, t >= 3";
+    if (s > (uint64_t{ 1 } << 24) || t > (uint64_t{ 1 } << 24))
+        throw "in PolygonalIntersection(): too many sides";
+
+    const uint64_t A{ s - 2 };
+    const uint64_t B{ t - 2 };
+    const uint64_t D{ A * B };
+    if (floorSqrt(D) * floorSqrt(D) == D)
+        throw "in PolygonalIntersection(): (s - 2)(t - 2) is a perfect square";
+
+    const PellSolution unit{ solvePell(D) };
+    if (unit.x.limbCount() > 1 || unit.x.getLimbs()[0] > (uint64_t{ 1 } << 24))
+        throw "in PolygonalIntersection(): fundamental unit too large to search below";
+    m_unitU = unit.x.getLimbs()[0];
+    m_unitV = unit.y.getLimbs()[0];
+
+    const int64_t sOffset{ static_cast<int64_t>(s) - 4 };
+    const int64_t tOffset{ static_cast<int64_t>(t) - 4 };
+    const int64_t C{ static_cast<int64_t>(B) * sOffset * sOffset - static_cast<int64_t>(A) * tOffset * tOffset };
+
+    /* Nagell's bound on Y for the solutions of
+    (B X)^2 - AB Y^2 = B C with the smallest Y in each
+    class, and so (allowing for a negative X there) the
+    largest Y of a minimal non-negative one, one step on: */
+    const double u{ static_cast<double>(m_unitU) };
+    const double v{ static_cast<double>(m_unitV) };
+    const double N{ static_cast<double>(B) * static_cast<double>(C) };
+    const double classY{ v * std::sqrt(std::fabs(N)) / std::sqrt(2.0 * (u + ((N > 0) ? 1.0 : -1.0))) };
+    const double classX{ std::sqrt((static_cast<double>(A) * classY * classY + std::fabs(static_cast<double>(C)))
+        / static_cast<double>(B)) };
+    const double searchY{ static_cast<double>(B) * v * classX + u * classY + 1.0 };
+    if (searchY > 1e8)
+        throw "in PolygonalIntersection(): minimal solutions too large to search for";
+
+    const int64_t unitU{ static_cast<int64_t>(m_unitU) };
+    const int64_t unitV{ static_cast<int64_t>(m_unitV) };
+    for (int64_t Y{ 0 }; Y <= static_cast<int64_t>(searchY); ++Y)
+    {
+        const int64_t BX2{ static_cast<int64_t>(A) * Y * Y + C };
+        if (BX2 < 0 || BX2 % static_cast<int64_t>(B) != 0)
+            continue;
+        const int64_t X{ static_cast<int64_t>(floorSqrt(static_cast<uint64_t>(BX2 / static_cast<int64_t>(B)))) };
+        if (X * X != BX2 / static_cast<int64_t>(B))
+            continue;
+
+        /* Minimal if the inverse map leaves the quadrant: */
+        const int64_t previousX{ unitU * X - static_cast<int64_t>(A) * unitV * Y };
+        const int64_t previousY{ unitU * Y - static_cast<int64_t>(B) * unitV * X };
+        if (previousX >= 0 && previousY >= 0)
+            continue;
+
+        m_chainX.push_back(static_cast<uint64_t>(X));
+        m_chainY.push_back(static_cast<uint64_t>(Y));
+    }
+
+    if (m_chainX.empty())
+        throw "in PolygonalIntersection(): no solutions found";
+}
+
+
+void PolygonalIntersection::stepChain(std::size_t chain)
+{
+    const BigUInt& X{ m_chainX[chain] };
+    const BigUInt& Y{ m_chainY[chain] };
+
+    BigUInt nextX{ X * m_unitU };
+    nextX.addMultiple(Y, (m_s - 2) * m_unitV);
+    BigUInt nextY{ X * ((m_t - 2) * m_unitV) };
+    nextY.addMultiple(Y, m_unitU);
+
+    m_chainX[chain] = std::move(nextX);
+    m_chainY[chain] = std::move(nextY);
+}
+
+
+bool PolygonalIntersection::polygonalIndex(const BigUInt& X, uint64_t k, BigUInt& index)
+{
+    /* n = (X + (k - 4)) / (2 (k - 2)), where k - 4 is only
+    negative (-1) for triangles: */
+    index = X;
+    if (k >= 4)
+        index += k - 4;
+    else if (index.isZero())
+        return false;
+    else
+        index -= BigUInt{ 1 };
+
+    return index.divideBy(static_cast<uint32_t>(2 * (k - 2))) == 0 && !index.isZero();
+}
+
+
+FigurateMatch PolygonalIntersection::next()
+{
+    FigurateMatch match{};
+    while (true)
+    {
+        /* The chain that is furthest behind: */
+        std::size_t chain{ 0 };
+        for (std::size_t i{ 1 }; i < m_chainX.size(); ++i)
+        {
+            if (m_chainX[i] < m_chainX[chain])
+                chain = i;
+        }
+
+        const bool found{ polygonalIndex(m_chainX[chain], m_s, match.sIndex)
+            && polygonalIndex(m_chainY[chain], m_t, match.tIndex) };
+
+        if (found)
+        {
+            /* value = (X^2 - (s - 4)^2) / (8 (s - 2)): */
+            const uint64_t sOffset{ (m_s >= 4) ? m_s - 4 : 4 - m_s };
+            match.value = m_chainX[chain] * m_chainX[chain];
+            match.value -= BigUInt{ sOffset * sOffset };
+            match.value.divideBy(static_cast<uint32_t>(8 * (m_s - 2)));
+        }
+
+        stepChain(chain);
+        if (found)
+            return match;
+    }
+}
@@ -0,0 +1,74 @@
+/* Numbers of two polygonal kinds at once, shared between problems;
+   accessed through #include "../SharedLibrary/FigurateIntersection.h" */
+
+#ifndef SHAREDLIBRARY_FIGURATEINTERSECTION_H
+#define SHAREDLIBRARY_FIGURATEINTERSECTION_H
+
+#include <cstddef> // For std::size_t.
+#include <cstdint> // For large integer (non-digit) types.
+#include <vector>
+
+#include "BigUInt.h"
+
+
+/* value = P_s(sIndex) = P_t(tIndex): */
+struct FigurateMatch
+{
+    BigUInt value{};
+    BigUInt sIndex{};
+    BigUInt tIndex{};
+};
+
+
+/* Emits, in increasing order, the numbers that are both
+s-gonal and t-gonal, where
+    P_s(n) = ((s - 2) n^2 - (s - 4) n) / 2
+(s = 3 triangular, 5 pentagonal, 6 hexagonal, ...).
+
+Completing the square, with A = s - 2 and B = t - 2,
+    8 A P_s(n) + (s - 4)^2 = X^2,  X = 2 A n - (s - 4)
+    8 B P_t(m) + (t - 4)^2 = Y^2,  Y = 2 B m - (t - 4),
+so a common value means the generalized Pell equation
+    B X^2 - A Y^2 = C,  C = B (s - 4)^2 - A (t - 4)^2.
+If (u, v) is the minimal solution of u^2 - AB v^2 = 1
+(solvePell()), then
+    (X, Y) -> (u X + A v Y, B v X + u Y)
+maps solutions to larger solutions, so all positive ones
+fall into a few chains, each started by a "minimal"
+solution that the inverse map would make non-positive.
+Those lie below a bound from u, v and C (Nagell's bound,
+mapped forward once) and are found by a short search at
+construction.  next() then steps whichever chain is
+behind, with BigUInt, and skips the (X, Y) where n or m is
+not a positive integer, which is a periodic pattern along
+each chain.
+
+Throws (a const char*) unless s, t >= 3 and s != t, if
+A * B is a perfect square (the equation then factors,
+e.g. every hexagonal number is triangular), or if the
+minimal solutions are too large for the search. */
+class PolygonalIntersection
+{
+private:
+    uint64_t m_s{};
+    uint64_t m_t{};
+    uint64_t m_unitU{};
+    uint64_t m_unitV{};
+
+    /* The next (X, Y) of each chain, not yet looked at: */
+    std::vector<BigUInt> m_chainX{};
+    std::vector<BigUInt> m_chainY{};
+
+    void stepChain(std::size_t chain);
+
+    /* Index n with 2 (k - 2) n - (k - 4) = X, if any: */
+    static bool polygonalIndex(const BigUInt& X, uint64_t k, BigUInt& index);
+
+public:
+    PolygonalIntersection(uint64_t s, uint64_t t);
+
+    /* The next common value (the first is always 1): */
+    FigurateMatch next();
+};
+
+#endif
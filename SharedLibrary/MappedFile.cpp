@@ -0,0 +1,137 @@
+/* Read-only memory-mapped file, shared between problems;
+   accessed through #include "../SharedLibrary/MappedFile.h" */
+
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h> // For open().
+#include <sys/mman.h> // For mmap().
+#include <sys/stat.h> // For fstat().
+#include <unistd.h> // For close().
+#endif
+
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    HANDLE file{ CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr) };
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+    m_fileHandle = file;
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size))
+    {
+        close();
+        return;
+    }
+    m_size = static_cast<std::size_t>(size.QuadPart);
+
+    /* A zero-length file cannot be mapped, but is
+    still a valid (empty) file: */
+    if (m_size == 0)
+    {
+        m_open = true;
+        return;
+    }
+
+    HANDLE mapping{ CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) };
+    if (mapping == nullptr)
+    {
+        close();
+        return;
+    }
+    m_mappingHandle = mapping;
+
+    m_data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (m_data == nullptr)
+    {
+        close();
+        return;
+    }
+
+    m_open = true;
+}
+
+
+void MappedFile::close()
+{
+    if (m_data != nullptr)
+        UnmapViewOfFile(m_data);
+    if (m_mappingHandle != nullptr)
+        CloseHandle(m_mappingHandle);
+    if (m_fileHandle != nullptr)
+        CloseHandle(m_fileHandle);
+
+    m_data = nullptr;
+    m_mappingHandle = nullptr;
+    m_fileHandle = nullptr;
+    m_size = 0;
+    m_open = false;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    m_fd = ::open(filename.c_str(), O_RDONLY);
+    if (m_fd < 0)
+        return;
+
+    struct stat info {};
+    if (fstat(m_fd, &info) != 0)
+    {
+        close();
+        return;
+    }
+    m_size = static_cast<std::size_t>(info.st_size);
+
+    /* A zero-length file cannot be mapped, but is
+    still a valid (empty) file: */
+    if (m_size == 0)
+    {
+        m_open = true;
+        return;
+    }
+
+    void* mapped{ mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0) };
+    if (mapped == MAP_FAILED)
+    {
+        close();
+        return;
+    }
+    m_data = static_cast<const char*>(mapped);
+
+    /* We read front to back exactly once: */
+    madvise(mapped, m_size, MADV_SEQUENTIAL);
+
+    m_open = true;
+}
+
+
+void MappedFile::close()
+{
+    if (m_data != nullptr)
+        munmap(const_cast<char*>(m_data), m_size);
+    if (m_fd >= 0)
+        ::close(m_fd);
+
+    m_data = nullptr;
+    m_fd = -1;
+    m_size = 0;
+    m_open = false;
+}
+
+#endif
+
+
+MappedFile::~MappedFile()
+{
+    close();
+}
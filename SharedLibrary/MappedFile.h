@@ -0,0 +1,45 @@
+/* Read-only memory-mapped file, shared between problems;
+   accessed through #include "../SharedLibrary/MappedFile.h" */
+
+#ifndef SHAREDLIBRARY_MAPPEDFILE_H
+#define SHAREDLIBRARY_MAPPEDFILE_H
+
+#include <cstddef> // For std::size_t.
+#include <string> // For std::string.
+
+
+/* Maps a whole file into memory, read-only, for as long
+as the object lives.  The operating system pages the file
+in as it is read, so even files far larger than RAM can be
+scanned front to back without any buffering of our own.
+Check isOpen() (as with std::ifstream::is_open()) before
+using data(); an empty file is open with size() == 0. */
+class MappedFile
+{
+private:
+    const char* m_data{ nullptr };
+    std::size_t m_size{};
+    bool m_open{ false };
+
+#if defined(_WIN32)
+    void* m_fileHandle{ nullptr };
+    void* m_mappingHandle{ nullptr };
+#else
+    int m_fd{ -1 };
+#endif
+
+    void close();
+
+public:
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const { return m_open; }
+    const char* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+};
+
+#endif
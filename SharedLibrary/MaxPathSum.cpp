@@ -0,0 +1,435 @@
+/* Maximum path sum engine for number triangles (Problems 18 and 67);
+   accessed through #include "../SharedLibrary/MaxPathSum.h" */
+
+#include "MaxPathSum.h"
+
+#include <algorithm> // For std::max(), std::max_element().
+#include <cassert>
+#include <cstring> // For std::memcmp(), std::memcpy().
+#include <fstream> // For writing via ofstream.
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "MappedFile.h"
+
+
+namespace
+{
+    /* Stands in for "no path" beyond either end of a row;
+    small enough never to win a max, yet far enough from
+    INT64_MIN that adding a row value cannot overflow. */
+    constexpr pathsum_t noPath{ INT64_MIN / 4 };
+
+    /* ORs a group of (at most four) bits into a bit array at
+    position pos, spilling into the next word if need be: */
+    inline void orBits(uint64_t* bits, uint64_t pos, uint64_t mask)
+    {
+        const unsigned shift{ static_cast<unsigned>(pos & 63) };
+        bits[pos >> 6] |= mask << shift;
+        if (shift > 60)
+            bits[(pos >> 6) + 1] |= mask >> (64 - shift);
+    }
+
+    /* Position of the first argmax bit of row r: */
+    inline uint64_t rowBitOffset(int_fast64_t r)
+    {
+        return static_cast<uint64_t>(r) * static_cast<uint64_t>(r + 1) / 2;
+    }
+}
+
+
+void maxPlusRow(int32_t* out, const int32_t* in, const int32_t* row, std::size_t len)
+{
+    std::size_t i{ 0 };
+#if defined(__AVX2__)
+    for (; i + 8 <= len; i += 8)
+    {
+        const __m256i left{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)) };
+        const __m256i right{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i + 1)) };
+        const __m256i value{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i)) };
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+            _mm256_add_epi32(value, _mm256_max_epi32(left, right)));
+    }
+#endif
+    for (; i < len; ++i)
+        out[i] = row[i] + std::max(in[i], in[i + 1]);
+}
+
+
+/* AVX2 has no 64-bit max, so a compare and a blend stand
+in for it: */
+void maxPlusRow(int64_t* out, const int64_t* in, const int64_t* row, std::size_t len)
+{
+    std::size_t i{ 0 };
+#if defined(__AVX2__)
+    for (; i + 4 <= len; i += 4)
+    {
+        const __m256i left{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)) };
+        const __m256i right{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i + 1)) };
+        const __m256i value{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i)) };
+        const __m256i best{ _mm256_blendv_epi8(left, right, _mm256_cmpgt_epi64(right, left)) };
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi64(value, best));
+    }
+#endif
+    for (; i < len; ++i)
+        out[i] = row[i] + std::max(in[i], in[i + 1]);
+}
+
+
+void maxPlusRowArgmax(int64_t* out, const int64_t* in, const int64_t* row, std::size_t len,
+    uint64_t* bits, uint64_t firstBit)
+{
+    std::size_t i{ 0 };
+#if defined(__AVX2__)
+    for (; i + 4 <= len; i += 4)
+    {
+        const __m256i left{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)) };
+        const __m256i right{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i + 1)) };
+        const __m256i value{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i)) };
+        const __m256i rightWins{ _mm256_cmpgt_epi64(right, left) };
+        const __m256i best{ _mm256_blendv_epi8(left, right, rightWins) };
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi64(value, best));
+
+        const int lanes{ _mm256_movemask_pd(_mm256_castsi256_pd(rightWins)) };
+        if (lanes != 0)
+            orBits(bits, firstBit + i, static_cast<uint64_t>(lanes));
+    }
+#endif
+    for (; i < len; ++i)
+    {
+        const bool rightWins{ in[i + 1] > in[i] };
+        out[i] = row[i] + (rightWins ? in[i + 1] : in[i]);
+        if (rightWins)
+            orBits(bits, firstBit + i, 1);
+    }
+}
+
+
+/* Starts numThreads - 1 threads (numThreads = 0 uses one
+per core); the caller of run() is the remaining one. */
+MaxPlusRowPool::MaxPlusRowPool(unsigned numThreads)
+{
+    if (numThreads == 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned slice{ 1 }; slice < numThreads; ++slice)
+        m_threads.emplace_back(&MaxPlusRowPool::workerLoop, this, slice);
+}
+
+
+MaxPlusRowPool::~MaxPlusRowPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_stop = true;
+    }
+    m_start.notify_all();
+    for (std::thread& t : m_threads)
+        t.join();
+}
+
+
+void MaxPlusRowPool::runSlice(unsigned slice)
+{
+    const std::size_t numSlices{ getNumThreads() };
+    const std::size_t begin{ m_len * slice / numSlices };
+    const std::size_t end{ m_len * (slice + 1) / numSlices };
+
+    maxPlusRow(m_out + begin, m_in + begin, m_row + begin, end - begin);
+}
+
+
+void MaxPlusRowPool::workerLoop(unsigned slice)
+{
+    int_fast64_t seen{ 0 };
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            m_start.wait(lock, [&]() { return m_stop || m_generation != seen; });
+            if (m_stop)
+                return;
+            seen = m_generation;
+        }
+
+        runSlice(slice);
+
+        bool last{};
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            last = (--m_pending == 0);
+        }
+        if (last)
+            m_done.notify_one();
+    }
+}
+
+
+/* maxPlusRow(out, in, row, len) over every thread; returns
+once the whole row is done. */
+void MaxPlusRowPool::run(int64_t* out, const int64_t* in, const int64_t* row, std::size_t len)
+{
+    assert(out != in);
+
+    if (m_threads.empty())
+    {
+        maxPlusRow(out, in, row, len);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_out = out;
+        m_in = in;
+        m_row = row;
+        m_len = len;
+        m_pending = static_cast<unsigned>(m_threads.size());
+        ++m_generation;
+    }
+    m_start.notify_all();
+
+    runSlice(0);
+
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_done.wait(lock, [&]() { return m_pending == 0; });
+}
+
+
+MaxPathSumRow::MaxPathSumRow(unsigned numThreads)
+{
+    if (numThreads != 1)
+        m_pool.reset(new MaxPlusRowPool(numThreads));
+}
+
+
+void MaxPathSumRow::reserveRows(std::size_t rows)
+{
+    m_prev.reserve(rows + 2);
+    m_next.reserve(rows + 2);
+    m_rowBuffer.reserve(rows);
+}
+
+
+void MaxPathSumRow::trackPath()
+{
+    if (m_numRows != 0)
+        throw "in MaxPathSumRow::trackPath(): rows have already been added";
+
+    m_trackPath = true;
+}
+
+
+void MaxPathSumRow::addRow(const pathsum_t* row, std::size_t len)
+{
+    if (static_cast<int_fast64_t>(len) != m_numRows + 1)
+        throw "in MaxPathSumRow::addRow(): row has the wrong number of entries";
+
+    m_next.resize(len + 2);
+    m_next[0] = noPath;
+    m_next[len + 1] = noPath;
+
+    if (m_numRows == 0)
+        m_next[1] = row[0];
+    else if (m_trackPath)
+    {
+        m_argmax.resize(rowBitOffset(m_numRows + 1) / 64 + 2);
+        maxPlusRowArgmax(m_next.data() + 1, m_prev.data(), row, len,
+            m_argmax.data(), rowBitOffset(m_numRows));
+    }
+    else if (m_pool && len >= parallelRowWidth)
+        m_pool->run(m_next.data() + 1, m_prev.data(), row, len);
+    else
+        maxPlusRow(m_next.data() + 1, m_prev.data(), row, len);
+
+    m_prev.swap(m_next);
+    ++m_numRows;
+}
+
+
+/* Widens an int32 row (e.g. straight from a mapped binary
+triangle file) and adds it: */
+void MaxPathSumRow::addRow(const int32_t* row, std::size_t len)
+{
+    m_rowBuffer.assign(row, row + len);
+    addRow(m_rowBuffer.data(), len);
+    m_rowBuffer.clear();
+}
+
+
+pathsum_t MaxPathSumRow::getMaxPathSum() const
+{
+    if (m_numRows == 0)
+        return 0;
+    return *std::max_element(m_prev.begin() + 1, m_prev.end() - 1);
+}
+
+
+/* Starts at the best entry of the last row and follows the
+argmax bits back up to the apex: */
+std::vector<int_fast64_t> MaxPathSumRow::getMaxPath() const
+{
+    if (!m_trackPath)
+        throw "in MaxPathSumRow::getMaxPath(): trackPath() was not called";
+
+    std::vector<int_fast64_t> path(static_cast<std::size_t>(m_numRows));
+    if (m_numRows == 0)
+        return path;
+
+    int_fast64_t column{ std::max_element(m_prev.begin() + 1, m_prev.end() - 1) - (m_prev.begin() + 1) };
+    for (int_fast64_t r{ m_numRows - 1 }; r > 0; --r)
+    {
+        path[r] = column;
+
+        const uint64_t bit{ rowBitOffset(r) + static_cast<uint64_t>(column) };
+        if (((m_argmax[bit >> 6] >> (bit & 63)) & 1) == 0)
+            --column;
+    }
+    path[0] = column;
+
+    return path;
+}
+
+
+/* Maximum path sum of a triangle held as text, with row r
+(counting from zero) made of the next r + 1 integers; line
+breaks are not needed.  Throws if the integers do not make
+up a whole number of rows.  numThreads is passed on to
+MaxPathSumRow (only rows of parallelRowWidth entries or
+more are split). */
+pathsum_t maxPathSumFromText(const char* data, std::size_t size, int_fast64_t& numRows,
+    unsigned numThreads, std::vector<int_fast64_t>* path)
+{
+    IntScanner scanner(data, size);
+    MaxPathSumRow dp(numThreads);
+    if (path)
+        dp.trackPath();
+
+    pathsum_t value{};
+    while (scanner.next(value))
+        dp.feed(value);
+
+    if (!dp.isComplete())
+        throw "in maxPathSumFromText(): the last row of the triangle is incomplete";
+
+    numRows = dp.getNumRows();
+    if (path)
+        *path = dp.getMaxPath();
+    return dp.getMaxPathSum();
+}
+
+
+/* Maximum path sum of a packed binary triangle (see
+TriangleFileHeader) held in memory.  Throws if the header
+is not one, or the data does not hold exactly numRows
+rows. */
+pathsum_t maxPathSumFromBinary(const char* data, std::size_t size, int_fast64_t& numRows,
+    unsigned numThreads, std::vector<int_fast64_t>* path)
+{
+    TriangleFileHeader header{};
+    if (size < sizeof(header))
+        throw "in maxPathSumFromBinary(): file too short for a triangle header";
+
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, triangleFileMagic, sizeof(triangleFileMagic)) != 0)
+        throw "in maxPathSumFromBinary(): not a packed triangle file";
+
+    /* rows < 2^32 keeps r (r + 1) in 64 bits, and the size
+    is divided down to an entry count rather than the count
+    multiplied up to bytes, which could wrap: */
+    const uint64_t rows{ header.numRows };
+    const uint64_t dataSize{ static_cast<uint64_t>(size - sizeof(header)) };
+    if (rows > UINT32_MAX || dataSize % sizeof(int32_t) != 0
+        || dataSize / sizeof(int32_t) != rowBitOffset(static_cast<int_fast64_t>(rows)))
+        throw "in maxPathSumFromBinary(): size does not match the number of rows";
+
+    MaxPathSumRow dp(numThreads);
+    if (path)
+        dp.trackPath();
+
+    /* The rows are mapped at a 4-byte aligned offset, so
+    each is read straight from the mapping (and widened into
+    the row buffer by addRow()): */
+    const int32_t* row{ reinterpret_cast<const int32_t*>(data + sizeof(header)) };
+    for (uint64_t r{ 0 }; r < rows; ++r)
+    {
+        dp.addRow(row, static_cast<std::size_t>(r) + 1);
+        row += r + 1;
+    }
+
+    numRows = dp.getNumRows();
+    if (path)
+        *path = dp.getMaxPath();
+    return dp.getMaxPathSum();
+}
+
+
+/* Converts a text triangle to the packed binary format,
+streaming it row by row; returns the number of rows.
+Throws if either file cannot be opened, the last row is
+incomplete or an entry does not fit in an int32_t. */
+int_fast64_t packTriangleFile(const std::string& textFilename, const std::string& binaryFilename)
+{
+    MappedFile text(textFilename);
+    if (!text.isOpen())
+        throw "in packTriangleFile(): could not open the triangle file";
+
+    std::ofstream out(binaryFilename, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+        throw "in packTriangleFile(): could not create the binary file";
+
+    /* The row count is not known until the end, so the
+    header is written again once it is: */
+    TriangleFileHeader header{};
+    std::memcpy(header.magic, triangleFileMagic, sizeof(triangleFileMagic));
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    IntScanner scanner(text.data(), text.size());
+    std::vector<int32_t> row{};
+    pathsum_t value{};
+
+    while (scanner.next(value))
+    {
+        if (value < INT32_MIN || value > INT32_MAX)
+            throw "in packTriangleFile(): entry does not fit in an int32";
+
+        row.push_back(static_cast<int32_t>(value));
+        if (row.size() == header.numRows + 1)
+        {
+            out.write(reinterpret_cast<const char*>(row.data()),
+                static_cast<std::streamsize>(row.size() * sizeof(int32_t)));
+            row.clear();
+            ++header.numRows;
+        }
+    }
+
+    if (!row.empty())
+        throw "in packTriangleFile(): the last row of the triangle is incomplete";
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!out)
+        throw "in packTriangleFile(): could not write the binary file";
+
+    return static_cast<int_fast64_t>(header.numRows);
+}
+
+
+/* Reads a text or packed binary triangle file (told apart
+by the magic bytes at the start) through a memory map.
+Throws if the file cannot be opened. */
+pathsum_t maxPathSumFromFile(const std::string& filename, int_fast64_t& numRows,
+    unsigned numThreads, std::vector<int_fast64_t>* path)
+{
+    MappedFile file(filename);
+    if (!file.isOpen())
+        throw "in maxPathSumFromFile(): could not open the triangle file";
+
+    if (file.size() >= sizeof(triangleFileMagic)
+        && std::memcmp(file.data(), triangleFileMagic, sizeof(triangleFileMagic)) == 0)
+        return maxPathSumFromBinary(file.data(), file.size(), numRows, numThreads, path);
+
+    return maxPathSumFromText(file.data(), file.size(), numRows, numThreads, path);
+}
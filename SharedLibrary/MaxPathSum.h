@@ -0,0 +1,220 @@
+/* Maximum path sum engine for number triangles (Problems 18 and 67);
+   accessed through #include "../SharedLibrary/MaxPathSum.h" */
+
+#ifndef SHAREDLIBRARY_MAXPATHSUM_H
+#define SHAREDLIBRARY_MAXPATHSUM_H
+
+#include <condition_variable>
+#include <cstddef> // For std::size_t.
+#include <cstdint> // For large integer (non-digit) types.
+#include <memory> // For std::unique_ptr.
+#include <mutex>
+#include <string> // For std::string.
+#include <thread>
+#include <vector>
+
+
+using pathsum_t = int64_t;
+
+
+/* Hand-written scanner pulling whitespace-separated
+(optionally negative) integers out of a block of text,
+without copying it or going through a stream: */
+class IntScanner
+{
+private:
+    const char* m_pos{};
+    const char* m_end{};
+
+public:
+    IntScanner(const char* data, std::size_t size) : m_pos{ data }, m_end{ data + size } {}
+
+    /* Reads the next integer into value; returns false
+    when the text holds no more integers: */
+    bool next(pathsum_t& value)
+    {
+        /* Skip anything that cannot start a number: */
+        while (m_pos != m_end && !(*m_pos >= '0' && *m_pos <= '9')
+            && !(*m_pos == '-' && m_pos + 1 != m_end && m_pos[1] >= '0' && m_pos[1] <= '9'))
+        {
+            ++m_pos;
+        }
+
+        if (m_pos == m_end)
+            return false;
+
+        const bool negative{ *m_pos == '-' };
+        if (negative)
+            ++m_pos;
+
+        pathsum_t result{ 0 };
+        while (m_pos != m_end && *m_pos >= '0' && *m_pos <= '9')
+        {
+            result = result * 10 + (*m_pos - '0');
+            ++m_pos;
+        }
+
+        value = negative ? -result : result;
+        return true;
+    }
+};
+
+
+/* Row kernel of the path sum DP (both directions reduce to it):
+    out[i] = row[i] + max(in[i], in[i + 1]) for 0 <= i < len,
+so in must hold len + 1 values.  out may be the very same
+array as in (the update then runs in place, left to right)
+or as row, but must not otherwise overlap either.  Built
+with AVX2 enabled, these compare shifted loads of in 8
+(int32) or 4 (int64) lanes at a time; otherwise they are
+plain loops. */
+void maxPlusRow(int32_t* out, const int32_t* in, const int32_t* row, std::size_t len);
+void maxPlusRow(int64_t* out, const int64_t* in, const int64_t* row, std::size_t len);
+
+/* As maxPlusRow(), also setting bit firstBit + i of bits
+whenever in[i + 1] won the max (strictly), i.e. recording
+which of the two choices each entry took.  The bits are
+ORed in, so they must start cleared, and bits must have
+one spare word past the last bit. */
+void maxPlusRowArgmax(int64_t* out, const int64_t* in, const int64_t* row, std::size_t len,
+    uint64_t* bits, uint64_t firstBit);
+
+
+/* Pool of threads that splits one (very wide) maxPlusRow()
+call into equal slices, the calling thread taking the
+first.  The threads live as long as the pool, so each row
+costs one wake-up rather than a thread start.  Here out
+must NOT be the same array as in, since one slice reads
+the in[i + 1] at the start of the next. */
+class MaxPlusRowPool
+{
+private:
+    std::vector<std::thread> m_threads{};
+    std::mutex m_mtx;
+    std::condition_variable m_start;
+    std::condition_variable m_done;
+    int_fast64_t m_generation{};
+    unsigned m_pending{};
+    bool m_stop{ false };
+
+    int64_t* m_out{};
+    const int64_t* m_in{};
+    const int64_t* m_row{};
+    std::size_t m_len{};
+
+    void runSlice(unsigned slice);
+    void workerLoop(unsigned slice);
+
+public:
+    explicit MaxPlusRowPool(unsigned numThreads = 0);
+    ~MaxPlusRowPool();
+
+    MaxPlusRowPool(const MaxPlusRowPool&) = delete;
+    MaxPlusRowPool& operator=(const MaxPlusRowPool&) = delete;
+
+    unsigned getNumThreads() const { return static_cast<unsigned>(m_threads.size()) + 1; }
+
+    void run(int64_t* out, const int64_t* in, const int64_t* row, std::size_t len);
+};
+
+
+/* Top-down maximum path sum over rolling rows: after row r
+is added, entry j of the current row holds the largest sum
+of a path from the apex down to entry j of row r.  Rows are
+added whole (addRow()) or one entry at a time (feed()), top
+to bottom, so the triangle never has to be held in memory;
+only two rows of sums and one row of input are kept.
+
+The sums are stored one place to the right with a very
+negative sentinel at both ends, so that
+    best[j] = row[j] + max(best[j - 1], best[j])
+of the row above is exactly one maxPlusRow() call, ends
+included.  Rows at least parallelRowWidth wide are split
+over threads when numThreads > 1.
+
+After trackPath(), each row also records one "argmax" bit
+per entry (set if the entry's best parent is the one
+directly above it, clear if it is the one up and to the
+left), so getMaxPath() can walk back up from the best entry
+of the last row.  That costs rows^2/16 bytes, and the rows
+are then never split over threads. */
+class MaxPathSumRow
+{
+private:
+    std::vector<pathsum_t> m_prev{};
+    std::vector<pathsum_t> m_next{};
+    std::vector<pathsum_t> m_rowBuffer{};
+    int_fast64_t m_numRows{};
+    std::unique_ptr<MaxPlusRowPool> m_pool{};
+
+    bool m_trackPath{ false };
+    std::vector<uint64_t> m_argmax{};
+
+public:
+    static constexpr std::size_t parallelRowWidth{ std::size_t{ 1 } << 16 };
+
+    explicit MaxPathSumRow(unsigned numThreads = 1);
+
+    void reserveRows(std::size_t rows);
+
+    /* Adds row number getNumRows(), which must have
+    getNumRows() + 1 entries: */
+    void addRow(const pathsum_t* row, std::size_t len);
+    void addRow(const int32_t* row, std::size_t len);
+
+    /* Must be called before the first row is added: */
+    void trackPath();
+
+    void feed(pathsum_t value)
+    {
+        m_rowBuffer.push_back(value);
+        if (static_cast<int_fast64_t>(m_rowBuffer.size()) == m_numRows + 1)
+        {
+            addRow(m_rowBuffer.data(), m_rowBuffer.size());
+            m_rowBuffer.clear();
+        }
+    }
+
+    /* True if every row fed so far is complete: */
+    bool isComplete() const { return m_rowBuffer.empty(); }
+
+    int_fast64_t getNumRows() const { return m_numRows; }
+
+    /* Largest path sum through the rows added so far: */
+    pathsum_t getMaxPathSum() const;
+
+    /* Entry (column) taken in each row, apex first, by a
+    path achieving getMaxPathSum(); needs trackPath(): */
+    std::vector<int_fast64_t> getMaxPath() const;
+};
+
+
+/* Packed binary triangle file: this header, then the rows
+top to bottom as numRows * (numRows + 1) / 2 int32_t values
+(native, i.e. little-endian, byte order) with nothing in
+between, so row r starts r * (r + 1) / 2 values in.  Mapped
+into memory, the rows can be fed to MaxPathSumRow without
+any parsing. */
+struct TriangleFileHeader
+{
+    char magic[8];
+    uint64_t numRows;
+};
+
+constexpr char triangleFileMagic[8]{ 'P', 'A', 'T', 'H', 'T', 'R', 'I', '1' };
+
+
+int_fast64_t packTriangleFile(const std::string& textFilename, const std::string& binaryFilename);
+
+
+/* path, if given, receives getMaxPath() of the triangle: */
+pathsum_t maxPathSumFromText(const char* data, std::size_t size, int_fast64_t& numRows,
+    unsigned numThreads = 1, std::vector<int_fast64_t>* path = nullptr);
+
+pathsum_t maxPathSumFromBinary(const char* data, std::size_t size, int_fast64_t& numRows,
+    unsigned numThreads = 1, std::vector<int_fast64_t>* path = nullptr);
+
+pathsum_t maxPathSumFromFile(const std::string& filename, int_fast64_t& numRows,
+    unsigned numThreads = 1, std::vector<int_fast64_t>* path = nullptr);
+
+#endif
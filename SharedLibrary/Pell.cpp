@@ -0,0 +1,138 @@
+/* Pell equation solver, shared between problems;
+   accessed through #include "../SharedLibrary/Pell.h" */
+
+#include "Pell.h"
+
+#include <cmath> // For std::log10(), std::pow(), std::sqrt().
+#include <mutex>
+#include <utility> // For std::swap().
+#include <vector>
+
+#include "ContinuedFraction.h"
+
+
+PellSolution solvePell(uint64_t D)
+{
+    PellSolution solution{};
+    solution.D = D;
+
+    const uint64_t a0{ floorSqrt(D) };
+    if (a0 * a0 == D)
+    {
+        solution.x = 1;
+        return solution;
+    }
+
+    /* (h, k) is the latest convergent, (previousH, previousK)
+    the one before it, starting from h_(-1) / k_(-1) = 1 / 0: */
+    BigUInt h{ a0 };
+    BigUInt k{ 1 };
+    BigUInt previousH{ 1 };
+    BigUInt previousK{ 0 };
+
+    uint64_t m{ 0 };
+    uint64_t d{ 1 };
+    uint64_t a{ a0 };
+    for (uint64_t i{ 1 }; ; ++i)
+    {
+        m = d * a - m;
+        d = (D - m * m) / d;
+        a = (a0 + m) / d;
+
+        /* h_(i-1)^2 - D k_(i-1)^2 = (-1)^i d_i, and d_i = 1
+        exactly at the ends of the periods: */
+        if (d == 1 && i % 2 == 0)
+            break;
+
+        previousH.addMultiple(h, a);
+        previousK.addMultiple(k, a);
+        std::swap(h, previousH);
+        std::swap(k, previousK);
+    }
+
+    solution.x = std::move(h);
+    solution.y = std::move(k);
+    return solution;
+}
+
+
+PellSize pellSize(uint64_t D)
+{
+    PellSize size{};
+    size.D = D;
+
+    const uint64_t a0{ floorSqrt(D) };
+    if (a0 * a0 == D)
+        return size;
+
+    const double root{ std::sqrt(static_cast<double>(D)) };
+    double log10Unit{ 0.0 };
+
+    uint64_t m{ 0 };
+    uint64_t d{ 1 };
+    uint64_t a{ a0 };
+    do
+    {
+        m = d * a - m;
+        d = (D - m * m) / d;
+        a = (a0 + m) / d;
+        log10Unit += std::log10((static_cast<double>(m) + root) / static_cast<double>(d));
+        ++size.periodLength;
+    } while (d != 1);
+
+    if (size.periodLength % 2 != 0)
+        log10Unit *= 2;
+
+    /* x = (u + 1 / u) / 2 for the unit u = x + y sqrt(D): */
+    size.log10X = log10Unit - std::log10(2.0) + std::log10(1.0 + std::pow(10.0, -2.0 * log10Unit));
+    return size;
+}
+
+
+PellSolution largestMinimalPellX(uint64_t maxD, unsigned numThreads)
+{
+    /* Relative error of a sum of l logarithms, with plenty
+    to spare: */
+    constexpr double tolerance{ 1e-9 };
+
+    std::mutex candidatesMutex{};
+    double bestLog10X{ 0.0 };
+    std::vector<PellSize> candidates{};
+
+    forEachDChunk(maxD, numThreads, [&](uint64_t first, uint64_t last)
+    {
+        /* Best of the chunk, plus any close to it: */
+        std::vector<PellSize> chunkCandidates{};
+        double chunkBest{ 0.0 };
+        for (uint64_t D{ first }; D <= last; ++D)
+        {
+            const PellSize size{ pellSize(D) };
+            if (size.log10X < chunkBest - tolerance * chunkBest)
+                continue;
+            if (size.log10X > chunkBest)
+                chunkBest = size.log10X;
+            chunkCandidates.push_back(size);
+        }
+
+        std::lock_guard<std::mutex> lock{ candidatesMutex };
+        if (chunkBest > bestLog10X)
+            bestLog10X = chunkBest;
+        for (const PellSize& size : chunkCandidates)
+        {
+            if (size.log10X >= bestLog10X - tolerance * bestLog10X)
+                candidates.push_back(size);
+        }
+    });
+
+    PellSolution best{ solvePell(1) };
+    for (const PellSize& size : candidates)
+    {
+        if (size.log10X < bestLog10X - tolerance * bestLog10X)
+            continue;
+
+        PellSolution solution{ solvePell(size.D) };
+        if (solution.x > best.x || (solution.x == best.x && solution.D < best.D))
+            best = std::move(solution);
+    }
+    return best;
+}
@@ -0,0 +1,55 @@
+/* Pell equation solver, shared between problems;
+   accessed through #include "../SharedLibrary/Pell.h" */
+
+#ifndef SHAREDLIBRARY_PELL_H
+#define SHAREDLIBRARY_PELL_H
+
+#include <cstdint> // For large integer (non-digit) types.
+
+#include "BigUInt.h"
+
+
+/* The minimal solution of x^2 - D y^2 = 1 (x = 1, y = 0
+for a square D, which has no other): */
+struct PellSolution
+{
+    uint64_t D{};
+    BigUInt x{};
+    BigUInt y{};
+};
+
+
+/* The same solution, "compressed" to its size: log10(x),
+computed without ever forming x.  Going once round the
+period of sqrt(D) = [a0; (a_1, ..., a_l)] multiplies
+x + y sqrt(D) by (m_i + sqrt(D)) / d_i at each step (with
+the m_i, d_i of ContinuedFraction.h), so
+    log(x + y sqrt(D)) = sum over i = 1..l of log((m_i + sqrt(D)) / d_i),
+doubled for odd l (where one round only solves
+x^2 - D y^2 = -1), and with u = x + y sqrt(D),
+x = (u + 1 / u) / 2.  That is O(l) double additions
+rather than O(l^2) limb operations, and no memory. */
+struct PellSize
+{
+    uint64_t D{};
+    double log10X{};
+    uint64_t periodLength{};
+};
+
+
+/* x / y is the convergent h_(n-1) / k_(n-1) of sqrt(D),
+with n the period length, or twice that for an odd one;
+each convergent is h_i = a_i h_(i-1) + h_(i-2) (the same
+for k), done in place with BigUInt::addMultiple(). */
+PellSolution solvePell(uint64_t D);
+
+/* See PellSize (log10X = 0 for a square D): */
+PellSize pellSize(uint64_t D);
+
+/* The D <= maxD with the largest minimal x, over numThreads
+threads (0 for one per core).  Every D is ranked by
+pellSize(), and only those within rounding of the best are
+then solved exactly to settle the order. */
+PellSolution largestMinimalPellX(uint64_t maxD, unsigned numThreads = 0);
+
+#endif
@@ -0,0 +1,190 @@
+/* Exact square roots and polygonal-number tests, shared between
+   problems; accessed through #include "../SharedLibrary/Polygonal.h" */
+
+#ifndef SHAREDLIBRARY_POLYGONAL_H
+#define SHAREDLIBRARY_POLYGONAL_H
+
+#include <cmath> // For std::sqrt(), std::ldexp().
+#include <cstdint> // For large integer (non-digit) types.
+
+#include "UInt128.h"
+
+
+/* floor(sqrt(n)), exactly.  The double square root is off
+by at most one either way (n itself is rounded to 53 bits
+on the way in), so one comparison each way fixes it; the
+compiler turns both into flag arithmetic rather than
+branches.  The root is capped below 2^32 first, so neither
+square can overflow. */
+inline uint64_t isqrt(uint64_t n)
+{
+    uint64_t root{ static_cast<uint64_t>(std::sqrt(static_cast<double>(n))) };
+    root = (root > 0xFFFFFFFF) ? 0xFFFFFFFF : root;
+    root -= (root * root > n) ? 1 : 0;
+    root += (root < 0xFFFFFFFF && (root + 1) * (root + 1) <= n) ? 1 : 0;
+    return root;
+}
+
+
+/* floor(sqrt(n)) of a 128-bit n (which fits in 64 bits).
+The double estimate is only good to about 2^11 here, so
+one Newton step on the exact residual n - root^2 (small
+enough to be taken as a double) comes first. */
+inline uint64_t isqrt(const UInt128& n)
+{
+    if (n.high() == 0)
+        return isqrt(n.low());
+
+    auto toDouble = [](const UInt128& value)
+    {
+        return std::ldexp(static_cast<double>(value.high()), 64) + static_cast<double>(value.low());
+    };
+
+    /* Both the estimate and the Newton step can round up to
+    2^64, which does not convert, so they are clamped to the
+    largest double below it: */
+    auto toRoot = [](double value)
+    {
+        return (value >= 18446744073709549568.0) ? UINT64_MAX : static_cast<uint64_t>(value);
+    };
+
+    uint64_t root{ toRoot(std::sqrt(toDouble(n))) };
+
+    const UInt128 square{ UInt128::multiply(root, root) };
+    const double step{ ((square > n) ? -toDouble(square - n) : toDouble(n - square)) / (2.0 * static_cast<double>(root)) };
+    root = toRoot(static_cast<double>(root) + step);
+
+    while (UInt128::multiply(root, root) > n)
+        --root;
+    while (root != UINT64_MAX && UInt128::multiply(root + 1, root + 1) <= n)
+        ++root;
+    return root;
+}
+
+
+/* Which residues are squares modulo 64, 63, 65 and 11.  A
+square passes all four, and only about 1 in 120 other
+values does.  For 64 bits the mod 64 test alone pays (the
+other three cost about as much as the double square root
+they would save); before the much slower 128-bit root, all
+four are worth it. */
+struct SquareFilterTables
+{
+    bool mod64[64]{};
+    bool mod63[63]{};
+    bool mod65[65]{};
+    bool mod11[11]{};
+
+    constexpr SquareFilterTables()
+    {
+        for (int i{ 0 }; i < 65; ++i)
+        {
+            mod64[(i * i) % 64] = true;
+            mod63[(i * i) % 63] = true;
+            mod65[(i * i) % 65] = true;
+            mod11[(i * i) % 11] = true;
+        }
+    }
+};
+
+constexpr SquareFilterTables squareFilterTables{};
+
+
+/* True if n is a perfect square (root is then set to its
+square root): */
+inline bool isSquare(uint64_t n, uint64_t& root)
+{
+    if (!squareFilterTables.mod64[n & 63])
+        return false;
+
+    root = isqrt(n);
+    return root * root == n;
+}
+
+inline bool isSquare(const UInt128& n, uint64_t& root)
+{
+    if (n.high() == 0)
+        return isSquare(n.low(), root);
+    if (!squareFilterTables.mod64[n.low() & 63])
+        return false;
+
+    /* One division for the other three (63 * 65 * 11): */
+    UInt128 quotient{ n };
+    const uint32_t residue{ quotient.divideBy(45045) };
+    if (!squareFilterTables.mod63[residue % 63] || !squareFilterTables.mod65[residue % 65]
+        || !squareFilterTables.mod11[residue % 11])
+        return false;
+
+    root = isqrt(n);
+    return UInt128::multiply(root, root) == n;
+}
+
+
+/* The n-th s-gonal number, P_s(n) = ((s - 2) n^2 - (s - 4) n) / 2
+(s = 3 triangular, 4 square, 5 pentagonal, ...): */
+inline UInt128 polygonalNumber(uint64_t s, uint64_t n)
+{
+    UInt128 twice{ UInt128::multiply(n, n) * UInt128{ s - 2 } };
+    if (s >= 4)
+        twice -= UInt128::multiply(s - 4, n);
+    else
+        twice += UInt128{ n };
+    return twice >> 1;
+}
+
+
+/* The index n >= 1 with 2 (s - 2) n - (s - 4) = root, if
+there is one (s - 4 is only negative, -1, for triangles): */
+inline bool polygonalIndexFromRoot(uint64_t s, uint64_t root, uint64_t& index)
+{
+    const uint64_t numerator{ (s >= 4) ? root + (s - 4) : root - 1 };
+    if (root == 0 || numerator == 0 || numerator % (2 * (s - 2)) != 0)
+        return false;
+
+    index = numerator / (2 * (s - 2));
+    return true;
+}
+
+
+/* True if x is an s-gonal number P_s(n) with n >= 1 (index
+is then set to n), for 3 <= s < 2^28.  Completing the
+square,
+    x = P_s(n)  <=>  8 (s - 2) x + (s - 4)^2 = (2 (s - 2) n - (s - 4))^2,
+so x is s-gonal exactly when the left side is a perfect
+square whose root gives a whole n.  The left side is formed
+in 128 bits, so any uint64_t x works, and the whole test is
+integer-exact (taking sqrt(24 x + 1) etc. as a double goes
+wrong once that passes 2^53). */
+inline bool isPolygonal(uint64_t s, uint64_t x, uint64_t& index)
+{
+    const uint64_t offset{ (s >= 4) ? s - 4 : 4 - s };
+    uint64_t root{};
+
+    /* The usual case, where the left side fits in 64 bits: */
+    if (x <= (UINT64_MAX - offset * offset) / (8 * (s - 2)))
+        return isSquare(8 * (s - 2) * x + offset * offset, root) && polygonalIndexFromRoot(s, root, index);
+
+    const UInt128 square{ UInt128::multiply(8 * (s - 2), x) + UInt128{ offset * offset } };
+    return isSquare(square, root) && polygonalIndexFromRoot(s, root, index);
+}
+
+inline bool isPolygonal(uint64_t s, uint64_t x)
+{
+    uint64_t index{};
+    return isPolygonal(s, x, index);
+}
+
+
+/* The same for a 128-bit x, as long as
+8 (s - 2) x + (s - 4)^2 stays below 2^128 (e.g. x < 2^123
+for s up to 6): */
+inline bool isPolygonal(uint64_t s, const UInt128& x, uint64_t& index)
+{
+    const uint64_t offset{ (s >= 4) ? s - 4 : 4 - s };
+    const UInt128 square{ x * UInt128{ 8 * (s - 2) } + UInt128{ offset * offset } };
+
+    uint64_t root{};
+    return isSquare(square, root) && polygonalIndexFromRoot(s, root, index);
+}
+
+#endif
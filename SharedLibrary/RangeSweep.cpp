@@ -0,0 +1,215 @@
+/* Sharded, checkpointed sweeps over long ranges, shared between
+   problems; accessed through #include "../SharedLibrary/RangeSweep.h" */
+
+#include "RangeSweep.h"
+
+#include <algorithm> // For std::max(), std::min().
+#include <atomic>
+#include <chrono>
+#include <cstddef> // For std::size_t.
+#include <cstdio> // For std::remove(), std::rename().
+#include <exception> // For std::exception_ptr.
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility> // For std::move().
+
+
+namespace
+{
+    const std::string checkpointTag{ "RANGESWEEP1" };
+
+
+    /* Reads the checkpoint of the sweep (or, if it is
+    missing, the temporary copy that a crash between the
+    two steps of writeCheckpoint() leaves behind); returns
+    false if there is neither. */
+    bool readCheckpoint(const std::string& filename, uint64_t first, uint64_t last, uint64_t shardSize,
+        uint64_t& nextShard, SweepState& state)
+    {
+        std::ifstream file{ filename };
+        if (!file.is_open())
+            file.open(filename + ".tmp");
+        if (!file.is_open())
+            return false;
+
+        std::string tag{};
+        uint64_t fileFirst{}, fileLast{}, fileShardSize{}, stateSize{};
+        if (!(file >> tag >> fileFirst >> fileLast >> fileShardSize >> nextShard >> stateSize)
+            || tag != checkpointTag)
+            throw "in sweepRange(): the checkpoint file is not readable";
+        if (fileFirst != first || fileLast != last || fileShardSize != shardSize || stateSize != state.size())
+            throw "in sweepRange(): the checkpoint file is for a different sweep";
+
+        for (uint64_t& word : state)
+        {
+            if (!(file >> word))
+                throw "in sweepRange(): the checkpoint file is not readable";
+        }
+        return true;
+    }
+
+
+    /* Writes the whole checkpoint to a temporary file first,
+    so the previous one survives a crash mid-write: */
+    void writeCheckpoint(const std::string& filename, uint64_t first, uint64_t last, uint64_t shardSize,
+        uint64_t nextShard, const SweepState& state)
+    {
+        const std::string tempName{ filename + ".tmp" };
+        {
+            std::ofstream file{ tempName, std::ios::trunc };
+            file << checkpointTag << ' ' << first << ' ' << last << ' ' << shardSize << ' '
+                << nextShard << ' ' << state.size();
+            for (uint64_t word : state)
+                file << ' ' << word;
+            file << '\n';
+
+            file.close();
+            if (file.fail())
+                throw "in sweepRange(): could not write the checkpoint file";
+        }
+
+        /* std::rename() replaces an existing file on POSIX but
+        not on Windows: */
+        if (std::rename(tempName.c_str(), filename.c_str()) != 0)
+        {
+            std::remove(filename.c_str());
+            if (std::rename(tempName.c_str(), filename.c_str()) != 0)
+                throw "in sweepRange(): could not replace the checkpoint file";
+        }
+    }
+}
+
+
+SweepState sweepRange(uint64_t first, uint64_t last, const SweepState& initial,
+    const ShardWork& work, const ShardCombine& combine,
+    const RangeSweepOptions& options, const SweepFinished& isFinished)
+{
+    using clock = std::chrono::steady_clock;
+
+    if (first > last)
+        return initial;
+    if (options.shardSize == 0)
+        throw "in sweepRange(): shard size must be positive";
+
+    const uint64_t shardSize{ options.shardSize };
+    const uint64_t numShards{ (last - first) / shardSize + 1 };
+    const bool checkpointing{ !options.checkpointFile.empty() };
+
+    SweepState total{ initial };
+    uint64_t nextToCombine{ 0 };
+    if (checkpointing)
+        readCheckpoint(options.checkpointFile, first, last, shardSize, nextToCombine, total);
+
+    if (nextToCombine >= numShards || (isFinished && isFinished(total)))
+        return total;
+
+    unsigned numThreads{ options.numThreads };
+    if (numThreads == 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    numThreads = static_cast<unsigned>(std::min<uint64_t>(numThreads, numShards - nextToCombine));
+
+    const uint64_t startShard{ nextToCombine };
+    const clock::time_point startTime{ clock::now() };
+    clock::time_point lastCheckpoint{ startTime };
+    clock::time_point lastProgress{ startTime };
+
+    std::mutex mtx;
+    std::map<uint64_t, SweepState> finishedAhead{};
+    std::atomic<uint64_t> nextToTake{ nextToCombine };
+    std::atomic<bool> stop{ false };
+    std::exception_ptr error{};
+
+    /* Called with mtx held, after shards were combined: */
+    auto report = [&]()
+    {
+        const clock::time_point now{ clock::now() };
+
+        if (checkpointing && std::chrono::duration<double>(now - lastCheckpoint).count() >= options.checkpointSeconds)
+        {
+            writeCheckpoint(options.checkpointFile, first, last, shardSize, nextToCombine, total);
+            lastCheckpoint = now;
+        }
+
+        if (options.progressSeconds > 0 && nextToCombine > startShard
+            && std::chrono::duration<double>(now - lastProgress).count() >= options.progressSeconds)
+        {
+            const double seconds{ std::chrono::duration<double>(now - startTime).count() };
+            const double rate{ static_cast<double>(nextToCombine - startShard) * static_cast<double>(shardSize) / seconds };
+            const double remaining{ static_cast<double>(numShards - nextToCombine) * static_cast<double>(shardSize) };
+
+            std::cerr << "Swept " << nextToCombine << " of " << numShards << " shards ("
+                << 100.0 * static_cast<double>(nextToCombine) / static_cast<double>(numShards) << "%), "
+                << rate << " values/s, about " << static_cast<uint64_t>(remaining / rate) << " s left.\n";
+            lastProgress = now;
+        }
+    };
+
+    auto worker = [&]()
+    {
+        while (!stop)
+        {
+            const uint64_t shard{ nextToTake++ };
+            if (shard >= numShards)
+                return;
+
+            const uint64_t low{ first + shard * shardSize };
+            const uint64_t high{ low + std::min(shardSize - 1, last - low) };
+            SweepState state{ initial };
+
+            try
+            {
+                work(low, high, state);
+
+                std::lock_guard<std::mutex> lock{ mtx };
+                if (stop)
+                    return;
+                finishedAhead.emplace(shard, std::move(state));
+
+                /* Combine every shard that is now next in line: */
+                while (true)
+                {
+                    const auto next = finishedAhead.find(nextToCombine);
+                    if (next == finishedAhead.end())
+                        break;
+
+                    combine(total, next->second);
+                    finishedAhead.erase(next);
+                    ++nextToCombine;
+                    if (isFinished && isFinished(total))
+                    {
+                        stop = true;
+                        break;
+                    }
+                }
+                report();
+            }
+            catch (...)
+            {
+                /* The first exception from any thread is carried
+                back to the calling one: */
+                std::lock_guard<std::mutex> lock{ mtx };
+                if (!error)
+                    error = std::current_exception();
+                stop = true;
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> pool{};
+    for (unsigned t{ 1 }; t < numThreads; ++t)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread& t : pool)
+        t.join();
+
+    if (error)
+        std::rethrow_exception(error);
+
+    if (checkpointing)
+        writeCheckpoint(options.checkpointFile, first, last, shardSize, nextToCombine, total);
+    return total;
+}
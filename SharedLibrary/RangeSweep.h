@@ -0,0 +1,78 @@
+/* Sharded, checkpointed sweeps over long ranges, shared between
+   problems; accessed through #include "../SharedLibrary/RangeSweep.h" */
+
+#ifndef SHAREDLIBRARY_RANGESWEEP_H
+#define SHAREDLIBRARY_RANGESWEEP_H
+
+#include <cstdint> // For large integer (non-digit) types.
+#include <functional> // For std::function.
+#include <string> // For std::string.
+#include <vector>
+
+
+/* The running result of a sweep (a count, a best value and
+where it was found, ...), as a few 64-bit words so that
+any of them can be written to a checkpoint as is: */
+using SweepState = std::vector<uint64_t>;
+
+/* Sweeps one shard [first, last] into shard, which starts
+out as a copy of the initial state: */
+using ShardWork = std::function<void(uint64_t first, uint64_t last, SweepState& shard)>;
+
+/* Folds the state of the next shard (in range order) into
+the total: */
+using ShardCombine = std::function<void(SweepState& total, const SweepState& shard)>;
+
+/* Optional: true once the total can no longer change (e.g.
+the first hit of a search), which ends the sweep early: */
+using SweepFinished = std::function<bool(const SweepState& total)>;
+
+
+struct RangeSweepOptions
+{
+    /* Values per shard, the unit of work (and of work lost
+    after a crash): */
+    uint64_t shardSize{ uint64_t{ 1 } << 20 };
+
+    /* 0 for one per core: */
+    unsigned numThreads{ 0 };
+
+    /* Where to keep the checkpoint (none if empty), and how
+    often to rewrite it: */
+    std::string checkpointFile{};
+    double checkpointSeconds{ 60.0 };
+
+    /* How often to print progress (with the rate and the
+    time left) to std::cerr; 0 for never: */
+    double progressSeconds{ 10.0 };
+};
+
+
+/* Sweeps [first, last] a shard at a time on every thread,
+and returns the combination of initial with the states of
+all the shards, in order.
+
+The shards are taken by whichever thread is free, but are
+only combined in range order: a shard finished ahead of
+its turn waits until all before it are in.  So the
+combined state always covers exactly [first, x) for some
+shard boundary x, which is what the checkpoint holds (one
+line of text: the range, the shard size, x and the state),
+rewritten through a temporary file so that a crash while
+writing leaves the last one intact.  On start, a
+checkpoint for the same range and shard size is picked up
+where it left off; after a crash only the shards in
+flight are done again.  The file is kept once the sweep
+completes, so running again just gives the result.
+
+Separate processes can share a long sweep by each taking
+part of the range, with its own checkpoint file.  Throws
+(a const char*) if the checkpoint cannot be written or does
+not fit the sweep; whatever work or combine throws stops
+the sweep and is rethrown here, on the calling thread. */
+SweepState sweepRange(uint64_t first, uint64_t last, const SweepState& initial,
+    const ShardWork& work, const ShardCombine& combine,
+    const RangeSweepOptions& options = RangeSweepOptions{},
+    const SweepFinished& isFinished = SweepFinished{});
+
+#endif
@@ -0,0 +1,179 @@
+/* Segmented totient sieve over huge ranges, shared between problems;
+   accessed through #include "../SharedLibrary/SegmentedTotientSieve.h" */
+
+#include "SegmentedTotientSieve.h"
+
+#include <algorithm> // For std::max(), std::min().
+#include <condition_variable>
+#include <exception> // For std::exception_ptr.
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ArithmeticSieve.h"
+#include "Polygonal.h" // For isqrt().
+
+
+namespace
+{
+    /* Fills phi[i] = phi(low + i) for i < count, using
+    multiplications only.  Both phi and "factored" start at 1;
+    for every sieving prime p, each multiple of p gets
+    phi *= p - 1 and each multiple of a higher power p^k gets
+    phi *= p, while factored is multiplied by p every time, so
+    it ends up as the part of n made of primes up to sqrt(n).
+    What is left, n / factored, is then 1 or one last prime q,
+    which contributes q - 1. */
+    void sieveWindow(uint64_t low, std::size_t count, const std::vector<uint32_t>& primes,
+        std::vector<uint64_t>& phi, std::vector<uint64_t>& factored)
+    {
+        const uint64_t high{ low + count - 1 };
+
+        std::fill(phi.begin(), phi.begin() + count, 1);
+        std::fill(factored.begin(), factored.begin() + count, 1);
+
+        for (uint32_t p : primes)
+        {
+            if (static_cast<uint64_t>(p) * p > high)
+                break;
+
+            uint64_t power{ p };
+            uint64_t factor{ p - 1u };
+            while (true)
+            {
+                uint64_t multiple{ std::max<uint64_t>((low + power - 1) / power * power, power) };
+                for (; multiple <= high; multiple += power)
+                {
+                    const std::size_t i{ static_cast<std::size_t>(multiple - low) };
+                    phi[i] *= factor;
+                    factored[i] *= p;
+                }
+
+                if (power > high / p)
+                    break;
+                power *= p;
+                factor = p;
+            }
+        }
+
+        for (std::size_t i{ 0 }; i < count; ++i)
+        {
+            const uint64_t n{ low + i };
+            if (factored[i] < n)
+                phi[i] *= n / factored[i] - 1;
+        }
+
+        if (low == 0)
+            phi[0] = 0;
+    }
+}
+
+
+/* Computes phi(n) for every n in [first, last] a window
+of windowSize values at a time, sieving each window with
+the primes up to sqrt(last) only, so memory is
+O(sqrt(last) + windowSize) however long the range.  Every
+window is handed to reducer, in order, one call at a time.
+With numThreads > 1 (0 uses one per core) the windows are
+dealt round-robin to that many threads, each of which
+waits for its turn before calling reducer (from its own
+thread).  Throws if sqrt(last) is beyond a uint32_t; if
+reducer throws, no further windows are reduced and the
+exception is rethrown here. */
+void sieveTotientWindows(uint64_t first, uint64_t last, const TotientWindowReducer& reducer,
+    unsigned numThreads, std::size_t windowSize)
+{
+    if (first > last)
+        return;
+    if (windowSize == 0)
+        throw "in sieveTotientWindows(): window size must be positive";
+
+    const uint64_t sqrtLast{ isqrt(last) };
+    if (sqrtLast > UINT32_MAX)
+        throw "in sieveTotientWindows(): range too large for the sieving primes";
+
+    const ArithmeticSieve primeSieve(static_cast<uint32_t>(sqrtLast), 0);
+    const std::vector<uint32_t>& primes{ primeSieve.getPrimes() };
+
+    const uint64_t numWindows{ (last - first) / windowSize + 1 };
+
+    if (numThreads == 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    numThreads = static_cast<unsigned>(std::min<uint64_t>(numThreads, numWindows));
+
+    std::mutex mtx;
+    std::condition_variable turnChanged;
+    uint64_t nextToReduce{ 0 };
+    bool failed{ false };
+    std::exception_ptr error{};
+
+    /* Whatever is thrown first, on any thread, is carried
+    back to the calling one; every thread waiting for its
+    turn is woken up to stop: */
+    auto fail = [&]()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (!failed)
+            {
+                failed = true;
+                error = std::current_exception();
+            }
+        }
+        turnChanged.notify_all();
+    };
+
+    auto worker = [&](unsigned thread)
+    {
+        try
+        {
+            std::vector<uint64_t> phi(windowSize);
+            std::vector<uint64_t> factored(windowSize);
+
+            for (uint64_t window{ thread }; window < numWindows; window += numThreads)
+            {
+                const uint64_t low{ first + window * windowSize };
+                const std::size_t count{ static_cast<std::size_t>(
+                    std::min<uint64_t>(windowSize - 1, last - low) + 1) };
+
+                sieveWindow(low, count, primes, phi, factored);
+
+                std::unique_lock<std::mutex> lock(mtx);
+                turnChanged.wait(lock, [&]() { return failed || nextToReduce == window; });
+                if (failed)
+                    return;
+
+                reducer(low, phi.data(), count);
+                ++nextToReduce;
+                lock.unlock();
+                turnChanged.notify_all();
+            }
+        }
+        catch (...)
+        {
+            fail();
+        }
+    };
+
+    std::vector<std::thread> pool{};
+    for (unsigned t{ 1 }; t < numThreads; ++t)
+    {
+        try
+        {
+            pool.emplace_back(worker, t);
+        }
+        catch (...)
+        {
+            /* The windows of the missing threads would never
+            be reduced, so the others are stopped too: */
+            fail();
+            break;
+        }
+    }
+    worker(0);
+    for (std::thread& t : pool)
+        t.join();
+
+    if (failed)
+        std::rethrow_exception(error);
+}
@@ -0,0 +1,26 @@
+/* Segmented totient sieve over huge ranges, shared between problems;
+   accessed through #include "../SharedLibrary/SegmentedTotientSieve.h" */
+
+#ifndef SHAREDLIBRARY_SEGMENTEDTOTIENTSIEVE_H
+#define SHAREDLIBRARY_SEGMENTEDTOTIENTSIEVE_H
+
+#include <cstddef> // For std::size_t.
+#include <cstdint> // For large integer (non-digit) types.
+#include <functional> // For std::function.
+
+
+/* Receives one window of the range: phi[i] = phi(first + i)
+for 0 <= i < count.  The array is only valid during the
+call, so the reducer keeps whatever statistic it needs
+(a running minimum, a count, ...) and nothing else. */
+using TotientWindowReducer = std::function<void(uint64_t first, const uint64_t* phi, std::size_t count)>;
+
+/* Entries per window; two uint64_t arrays of this size
+(512 kB in all) stay in a typical L2 cache. */
+constexpr std::size_t defaultTotientWindow{ std::size_t{ 1 } << 15 };
+
+
+void sieveTotientWindows(uint64_t first, uint64_t last, const TotientWindowReducer& reducer,
+    unsigned numThreads = 1, std::size_t windowSize = defaultTotientWindow);
+
+#endif
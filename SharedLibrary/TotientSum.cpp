@@ -0,0 +1,78 @@
+/* Sublinear summatory totient function, shared between problems;
+   accessed through #include "../SharedLibrary/TotientSum.h" */
+
+#include "TotientSum.h"
+
+#include <algorithm> // For std::min().
+#include <cmath> // For std::cbrt().
+#include <vector>
+
+#include "ArithmeticSieve.h"
+
+
+namespace
+{
+    /* n * (n + 1) / 2, halving whichever factor is even
+    before the full product: */
+    UInt128 triangular(uint64_t n)
+    {
+        return (n % 2 == 0) ? UInt128::multiply(n / 2, n + 1) : UInt128::multiply(n, (n + 1) / 2);
+    }
+}
+
+
+UInt128 sumTotients(uint64_t n, uint64_t smallLimit)
+{
+    if (smallLimit == 0)
+    {
+        const double cubeRoot{ std::cbrt(static_cast<double>(n)) };
+        smallLimit = static_cast<uint64_t>(cubeRoot * cubeRoot);
+    }
+
+    /* The prefix sums must fit in a uint64_t (and the sieve
+    in a uint32_t); nothing is gained past n itself: */
+    smallLimit = std::min<uint64_t>({ smallLimit, n, 4000000000 });
+    smallLimit = std::max<uint64_t>(smallLimit, 1);
+
+
+    /* Phi(v) for v <= smallLimit: */
+    std::vector<uint64_t> smallSums(static_cast<std::size_t>(smallLimit) + 1);
+    {
+        const ArithmeticSieve sieve(static_cast<uint32_t>(smallLimit), sievePhi);
+        const std::vector<uint32_t>& phi{ sieve.getPhiTable() };
+        for (std::size_t v{ 1 }; v <= smallLimit; ++v)
+            smallSums[v] = smallSums[v - 1] + phi[v];
+    }
+
+    if (n <= smallLimit)
+        return smallSums[static_cast<std::size_t>(n)];
+
+
+    /* largeSums[k] = Phi(n / k) for every k with
+    n / k > smallLimit, i.e. k <= maxK: */
+    const uint64_t maxK{ n / (smallLimit + 1) };
+    std::vector<UInt128> largeSums(static_cast<std::size_t>(maxK) + 1);
+
+    for (uint64_t k{ maxK }; k >= 1; --k)
+    {
+        const uint64_t v{ n / k };
+        UInt128 total{ triangular(v) };
+
+        /* Every d in [d, dLast] gives the same q = v / d: */
+        for (uint64_t d{ 2 }, dLast{}; d <= v; d = dLast + 1)
+        {
+            const uint64_t q{ v / d };
+            dLast = v / q;
+
+            /* q = n / (k * d), so when large its sum sits at
+            index n / q (the largest index with that value): */
+            const UInt128 termSum{ (q <= smallLimit) ? UInt128{ smallSums[static_cast<std::size_t>(q)] }
+                : largeSums[static_cast<std::size_t>(n / q)] };
+            total -= termSum * (dLast - d + 1);
+        }
+
+        largeSums[static_cast<std::size_t>(k)] = total;
+    }
+
+    return largeSums[1];
+}
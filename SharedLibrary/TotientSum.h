@@ -0,0 +1,35 @@
+/* Sublinear summatory totient function, shared between problems;
+   accessed through #include "../SharedLibrary/TotientSum.h" */
+
+#ifndef SHAREDLIBRARY_TOTIENTSUM_H
+#define SHAREDLIBRARY_TOTIENTSUM_H
+
+#include <cstdint> // For large integer (non-digit) types.
+
+#include "UInt128.h"
+
+
+/* Phi(n) = phi(1) + phi(2) + ... + phi(n), without a table
+of phi up to n.  Every pair 1 <= a, b <= n has exactly one
+gcd d, and the pairs with gcd d and a <= b are counted by
+Phi(n / d) (rounded down), so
+    n * (n + 1) / 2 = sum over d = 1..n of Phi(n / d),
+i.e. (Du's sieve, or the Dirichlet hyperbola trick for
+phi * 1 = id)
+    Phi(n) = n * (n + 1) / 2 - sum over d = 2..n of Phi(n / d).
+n / d takes only O(sqrt(n)) distinct values, each for a
+whole run of d, and the values Phi is ever needed at are
+again of the form n / k.  So:
+    i) Phi(v) for v up to smallLimit is a prefix sum over a
+    linear sieve (ArithmeticSieve).
+    ii) Phi(n / k) for the larger values is memoized in an
+    array indexed by k (at most n / smallLimit of them),
+    filled from k = n / smallLimit down to k = 1, so the
+    values each one needs are always ready.
+With smallLimit around n^(2/3) (the default, 0) this is
+O(n^(2/3)) time and memory; e.g. about 2 * 10^7 sieve
+entries for n = 10^11.  Phi(n) is about 3 n^2 / pi^2, which
+passes 2^64 near n = 7.6 * 10^9, hence the 128-bit result. */
+UInt128 sumTotients(uint64_t n, uint64_t smallLimit = 0);
+
+#endif
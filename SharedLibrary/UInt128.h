@@ -0,0 +1,170 @@
+/* Portable unsigned 128-bit integer, shared between problems;
+   accessed through #include "../SharedLibrary/UInt128.h" */
+
+#ifndef SHAREDLIBRARY_UINT128_H
+#define SHAREDLIBRARY_UINT128_H
+
+#include <cstdint> // For large integer (non-digit) types.
+#include <ostream>
+#include <string> // For std::string.
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h> // For _umul128().
+#endif
+
+
+/* Unsigned 128-bit integer as two 64-bit halves, for sums
+and products that overflow uint64_t.  MSVC has no
+__int128, so this is what the solutions use everywhere;
+with GCC/Clang (or MSVC on x64) the one hard part, the full
+64 x 64 -> 128-bit product, still compiles to a single
+multiply instruction.  Arithmetic wraps modulo 2^128, just
+as it does for the built-in unsigned types. */
+class UInt128
+{
+private:
+    uint64_t m_high{};
+    uint64_t m_low{};
+
+public:
+    constexpr UInt128() = default;
+    constexpr UInt128(uint64_t low) : m_high{ 0 }, m_low{ low } {}
+    constexpr UInt128(uint64_t high, uint64_t low) : m_high{ high }, m_low{ low } {}
+
+    constexpr uint64_t high() const { return m_high; }
+    constexpr uint64_t low() const { return m_low; }
+
+    /* Full product of two 64-bit values: */
+    static UInt128 multiply(uint64_t a, uint64_t b)
+    {
+#if defined(_MSC_VER) && defined(_M_X64)
+        uint64_t high{};
+        const uint64_t low{ _umul128(a, b, &high) };
+        return UInt128{ high, low };
+#elif defined(__SIZEOF_INT128__)
+        const unsigned __int128 product{ static_cast<unsigned __int128>(a) * b };
+        return UInt128{ static_cast<uint64_t>(product >> 64), static_cast<uint64_t>(product) };
+#else
+        /* Schoolbook on 32-bit halves: */
+        const uint64_t aLow{ a & 0xFFFFFFFF }, aHigh{ a >> 32 };
+        const uint64_t bLow{ b & 0xFFFFFFFF }, bHigh{ b >> 32 };
+
+        const uint64_t lowLow{ aLow * bLow };
+        const uint64_t highLow{ aHigh * bLow };
+        const uint64_t lowHigh{ aLow * bHigh };
+        const uint64_t middle{ (lowLow >> 32) + (highLow & 0xFFFFFFFF) + (lowHigh & 0xFFFFFFFF) };
+
+        return UInt128{ aHigh * bHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32),
+            (middle << 32) | (lowLow & 0xFFFFFFFF) };
+#endif
+    }
+
+    UInt128& operator+=(const UInt128& other)
+    {
+        const uint64_t low{ m_low + other.m_low };
+        m_high += other.m_high + (low < m_low ? 1 : 0);
+        m_low = low;
+        return *this;
+    }
+
+    UInt128& operator-=(const UInt128& other)
+    {
+        const uint64_t low{ m_low - other.m_low };
+        m_high -= other.m_high + (low > m_low ? 1 : 0);
+        m_low = low;
+        return *this;
+    }
+
+    UInt128& operator*=(const UInt128& other)
+    {
+        UInt128 product{ multiply(m_low, other.m_low) };
+        product.m_high += m_high * other.m_low + m_low * other.m_high;
+        return *this = product;
+    }
+
+    UInt128& operator<<=(unsigned shift)
+    {
+        if (shift >= 64)
+        {
+            m_high = (shift >= 128) ? 0 : m_low << (shift - 64);
+            m_low = 0;
+        }
+        else if (shift > 0)
+        {
+            m_high = (m_high << shift) | (m_low >> (64 - shift));
+            m_low <<= shift;
+        }
+        return *this;
+    }
+
+    UInt128& operator>>=(unsigned shift)
+    {
+        if (shift >= 64)
+        {
+            m_low = (shift >= 128) ? 0 : m_high >> (shift - 64);
+            m_high = 0;
+        }
+        else if (shift > 0)
+        {
+            m_low = (m_low >> shift) | (m_high << (64 - shift));
+            m_high >>= shift;
+        }
+        return *this;
+    }
+
+    /* Divides in place by a 32-bit divisor, a 32-bit "digit"
+    at a time; returns the remainder: */
+    uint32_t divideBy(uint32_t divisor)
+    {
+        uint64_t remainder{ 0 };
+        uint64_t digits[4]{ m_high >> 32, m_high & 0xFFFFFFFF, m_low >> 32, m_low & 0xFFFFFFFF };
+        for (uint64_t& digit : digits)
+        {
+            const uint64_t current{ (remainder << 32) | digit };
+            digit = current / divisor;
+            remainder = current % divisor;
+        }
+        m_high = (digits[0] << 32) | digits[1];
+        m_low = (digits[2] << 32) | digits[3];
+        return static_cast<uint32_t>(remainder);
+    }
+
+    std::string toString() const
+    {
+        if (m_high == 0)
+            return std::to_string(m_low);
+
+        /* Peel off 9 decimal digits at a time: */
+        std::string result{};
+        UInt128 rest{ *this };
+        while (rest.m_high != 0)
+        {
+            std::string chunk{ std::to_string(rest.divideBy(1000000000)) };
+            result.insert(0, chunk.insert(0, 9 - chunk.size(), '0'));
+        }
+        return std::to_string(rest.m_low) + result;
+    }
+
+    friend UInt128 operator+(UInt128 a, const UInt128& b) { return a += b; }
+    friend UInt128 operator-(UInt128 a, const UInt128& b) { return a -= b; }
+    friend UInt128 operator*(UInt128 a, const UInt128& b) { return a *= b; }
+    friend UInt128 operator<<(UInt128 a, unsigned shift) { return a <<= shift; }
+    friend UInt128 operator>>(UInt128 a, unsigned shift) { return a >>= shift; }
+
+    friend bool operator==(const UInt128& a, const UInt128& b) { return a.m_high == b.m_high && a.m_low == b.m_low; }
+    friend bool operator!=(const UInt128& a, const UInt128& b) { return !(a == b); }
+    friend bool operator<(const UInt128& a, const UInt128& b)
+    {
+        return (a.m_high != b.m_high) ? a.m_high < b.m_high : a.m_low < b.m_low;
+    }
+    friend bool operator>(const UInt128& a, const UInt128& b) { return b < a; }
+    friend bool operator<=(const UInt128& a, const UInt128& b) { return !(b < a); }
+    friend bool operator>=(const UInt128& a, const UInt128& b) { return !(a < b); }
+
+    friend std::ostream& operator<<(std::ostream& out, const UInt128& value)
+    {
+        return out << value.toString();
+    }
+};
+
+#endif